@@ -0,0 +1,173 @@
+// balance子命令：在ChatServerRegistry上模拟会话的分配和断开，比较各策略的负载分布和选择耗时
+// 分配时和服务中一样立即计入连接数；断开在上报间隔为0时立即扣除，
+// 否则只在每次模拟上报（SetConnections覆盖为真实连接数）时才被注册表看到，对应聊天服务器的ReportLoad周期
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "ChatServerRegistry.h"
+#include "StatusBench.h"
+
+namespace {
+
+enum class SimPolicy { Random, RoundRobin, Least, TwoChoices };
+
+struct PolicyInfo {
+    SimPolicy policy;
+    const char* name;
+};
+
+const PolicyInfo kPolicies[] = {
+    { SimPolicy::Random, "random" },
+    { SimPolicy::RoundRobin, "round-robin" },
+    { SimPolicy::Least, "least" },
+    { SimPolicy::TwoChoices, "p2c" },
+};
+
+const std::size_t kServerCounts[] = { 2, 8, 32, 128, 500 };
+
+struct SimResult {
+    double mean_ratio = 0; // 采样的 最大连接数/平均连接数 的均值
+    double worst_ratio = 0; // 采样中 最大连接数/平均连接数 的最大值
+    double cv = 0;          // 采样的变异系数（标准差/平均值）的均值
+    double select_ns = 0;   // 一次选择加上计数增减的耗时
+};
+
+// random和round-robin不是服务支持的策略，在快照上直接实现，作为对照
+class Picker
+{
+public:
+    Picker(ChatServerRegistry& registry, SimPolicy policy, uint64_t seed)
+        : _registry(registry), _policy(policy), _rng(seed), _next(0)
+    {
+        _registry.SetPolicy(policy == SimPolicy::Least ? BalancePolicy::LeastConnections : BalancePolicy::TwoChoices);
+    }
+
+    std::shared_ptr<ChatServer> Pick() {
+        switch (_policy) {
+        case SimPolicy::Least:
+            return _registry.SelectLeastLoaded();
+        case SimPolicy::TwoChoices:
+            return _registry.SelectTwoChoices();
+        default:
+            break;
+        }
+        auto snapshot = _registry.Snapshot();
+        const auto& servers = snapshot->servers;
+        if (servers.empty()) {
+            return nullptr;
+        }
+        if (_policy == SimPolicy::RoundRobin) {
+            return servers[_next.fetch_add(1, std::memory_order_relaxed) % servers.size()];
+        }
+        return servers[_rng() % servers.size()];
+    }
+
+private:
+    ChatServerRegistry& _registry;
+    SimPolicy _policy;
+    std::mt19937_64 _rng;
+    std::atomic<uint64_t> _next;
+};
+
+SimResult simulate(SimPolicy policy, std::size_t serverCount, int sessionsPerServer, std::size_t reportEvery)
+{
+    ChatServerRegistry registry;
+    for (std::size_t i = 0; i < serverCount; ++i) {
+        registry.Add("chatserver" + std::to_string(i), "127.0.0.1", std::to_string(8090 + i));
+    }
+    auto snapshot = registry.Snapshot();
+    const auto& servers = snapshot->servers;
+    Picker picker(registry, policy, 42);
+
+    std::mt19937_64 rng(7);
+    std::vector<int> actual(serverCount, 0); // 真实连接数，id即注册顺序
+    std::vector<std::size_t> sessions;        // 每个在线会话所在的服务器
+    std::size_t target = serverCount * static_cast<std::size_t>(sessionsPerServer);
+    sessions.reserve(target);
+
+    // 先建立target个会话，之后每一步断开一个随机会话再接入一个新会话，总数保持不变
+    std::size_t warmup = target * 2;
+    std::size_t measure = target * 4;
+    std::size_t sample_every = std::max<std::size_t>(1, target / 100);
+    std::size_t samples = 0;
+    SimResult result;
+    for (std::size_t step = 0; step < target + warmup + measure; ++step) {
+        if (sessions.size() >= target) {
+            std::size_t victim = static_cast<std::size_t>(rng() % sessions.size());
+            std::size_t index = sessions[victim];
+            sessions[victim] = sessions.back();
+            sessions.pop_back();
+            --actual[index];
+            if (reportEvery == 0) {
+                registry.AddConnections(servers[index], -1);
+            }
+        }
+        auto server = picker.Pick();
+        registry.AddConnections(server, 1);
+        ++actual[server->id];
+        sessions.push_back(server->id);
+
+        if (reportEvery > 0 && step % reportEvery == 0) {
+            for (std::size_t i = 0; i < serverCount; ++i) {
+                registry.SetConnections(servers[i], actual[i]);
+            }
+        }
+
+        if (step >= target + warmup && step % sample_every == 0) {
+            double mean = static_cast<double>(sessions.size()) / static_cast<double>(serverCount);
+            double variance = 0;
+            int max_count = 0;
+            for (int count : actual) {
+                max_count = std::max(max_count, count);
+                variance += (count - mean) * (count - mean);
+            }
+            variance /= static_cast<double>(serverCount);
+            double ratio = max_count / mean;
+            result.mean_ratio += ratio;
+            result.worst_ratio = std::max(result.worst_ratio, ratio);
+            result.cv += std::sqrt(variance) / mean;
+            ++samples;
+        }
+    }
+    result.mean_ratio /= static_cast<double>(samples);
+    result.cv /= static_cast<double>(samples);
+
+    // 选择耗时：选中后加一再减一，负载保持不变，包含最少连接策略维护堆的开销
+    const int iterations = 1000000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        auto server = picker.Pick();
+        registry.AddConnections(server, 1);
+        registry.AddConnections(server, -1);
+    }
+    result.select_ns = ElapsedNs(start) / iterations;
+    return result;
+}
+
+}
+
+int RunBalanceSim(int argc, char* argv[])
+{
+    int sessions_per_server = argc >= 1 ? std::max(1, std::atoi(argv[0])) : 100;
+    // 上报间隔以接入的会话数计：0为断开立即可见，另一档为平均每台服务器接入10个会话上报一次
+    std::printf("每台服务器 %d 个会话，断开后按上报间隔才被注册表看到\n", sessions_per_server);
+    std::printf("%-12s %6s %8s %12s %12s %8s %10s\n",
+        "策略", "服务器", "上报间隔", "平均max/mean", "最差max/mean", "CV", "选择ns");
+    for (std::size_t servers : kServerCounts) {
+        for (std::size_t report : { std::size_t(0), servers * 10 }) {
+            for (const auto& info : kPolicies) {
+                auto result = simulate(info.policy, servers, sessions_per_server, report);
+                std::printf("%-12s %6zu %8zu %12.3f %12.3f %8.4f %10.1f\n",
+                    info.name, servers, report, result.mean_ratio, result.worst_ratio, result.cv, result.select_ns);
+            }
+        }
+    }
+    return 0;
+}
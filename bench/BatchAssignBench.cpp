@@ -0,0 +1,113 @@
+// batch子命令：BatchGetChatServer的服务端路径在不同批大小下每个uid的耗时
+// 每批先AssignBatch选服务器并计数，再生成令牌InsertBatch写入；
+// 对照为逐个uid调用Select + AddConnections + Insert，相当于每个用户一次GetChatServer
+// 不包含gRPC的序列化和网络往返，只比较加锁次数和批内摊销的差异
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "ChatServerRegistry.h"
+#include "ShardedTokenStore.h"
+#include "StatusBench.h"
+
+namespace {
+
+const std::size_t kBatchSizes[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256 };
+const std::size_t kServers = 16;
+const std::size_t kShards = 16;
+// uid在固定范围内循环使用，令牌表在预热后不再扩容，测得的是稳定状态下的开销
+const int kUidSpace = 1 << 16;
+
+void addServers(ChatServerRegistry& registry)
+{
+    registry.SetPolicy(BalancePolicy::LeastConnections);
+    for (std::size_t i = 0; i < kServers; ++i) {
+        registry.Add("chatserver" + std::to_string(i), "127.0.0.1", std::to_string(8090 + i));
+    }
+}
+
+// 逐个uid分配，返回每个uid的纳秒数
+double runSingle(int threads, int uidsPerThread)
+{
+    ChatServerRegistry registry;
+    addServers(registry);
+    ShardedTokenStore store(kShards, 86400);
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&registry, &store, t, uidsPerThread]() {
+            TokenBytes token;
+            for (int i = 0; i < uidsPerThread; ++i) {
+                int uid = (t * uidsPerThread + i) % kUidSpace;
+                auto server = registry.Select(uid);
+                registry.AddConnections(server, 1);
+                TokenGenerator::NextBytes(token);
+                store.Insert(uid, token);
+            }
+            });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return ElapsedNs(start) / (static_cast<double>(threads) * uidsPerThread);
+}
+
+// 按batch个uid一批分配，返回每个uid的纳秒数
+double runBatched(int threads, int uidsPerThread, std::size_t batch)
+{
+    ChatServerRegistry registry;
+    addServers(registry);
+    ShardedTokenStore store(kShards, 86400);
+    std::vector<std::thread> workers;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&registry, &store, t, uidsPerThread, batch]() {
+            std::vector<int> uids;
+            std::vector<std::pair<int, TokenBytes>> tokens;
+            uids.reserve(batch);
+            tokens.reserve(batch);
+            int next = t * uidsPerThread;
+            int end = next + uidsPerThread;
+            while (next < end) {
+                uids.clear();
+                tokens.clear();
+                for (std::size_t i = 0; i < batch && next < end; ++i) {
+                    uids.push_back(next++ % kUidSpace);
+                }
+                auto servers = registry.AssignBatch(uids);
+                for (std::size_t i = 0; i < uids.size(); ++i) {
+                    if (servers[i]) {
+                        tokens.emplace_back(uids[i], TokenBytes());
+                        TokenGenerator::NextBytes(tokens.back().second);
+                    }
+                }
+                store.InsertBatch(tokens);
+            }
+            });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return ElapsedNs(start) / (static_cast<double>(threads) * uidsPerThread);
+}
+
+}
+
+int RunBatchAssignBench(int argc, char* argv[])
+{
+    int uids = argc >= 1 ? std::max(1, std::atoi(argv[0])) : 1000000;
+    int threads = argc >= 2 ? std::max(1, std::atoi(argv[1]))
+        : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    std::printf("%zu台服务器，%zu个令牌分片，%d个线程，每线程 %d 个uid\n", kServers, kShards, threads, uids);
+    double single = runSingle(threads, uids);
+    std::printf("%8s %12s %8s\n", "批大小", "ns/uid", "加速比");
+    std::printf("%8s %12.1f %8.2f\n", "逐个", single, 1.0);
+    for (std::size_t batch : kBatchSizes) {
+        double ns = runBatched(threads, uids, batch);
+        std::printf("%8zu %12.1f %8.2f\n", batch, ns, single / ns);
+    }
+    return 0;
+}
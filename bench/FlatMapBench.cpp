@@ -0,0 +1,185 @@
+// flatmap子命令：令牌分片使用的FlatHashMap与改造前的std::unordered_map<int, std::string>对比
+// 分别统计插入和查找的速率以及占用的内存。FlatHashMap的内存取MemoryUsage()，
+// unordered_map通过计数分配器统计节点、桶数组和令牌字符串申请的字节数，不含malloc自身的开销
+// 用法：flatmap [flat|std|both] [条目数...]，默认both，条目数为1M、10M、50M；
+// 50M条目下unordered_map需要数GB内存，内存不够的机器可以只跑flat
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "FlatHashMap.h"
+#include "StatusBench.h"
+#include "TokenGenerator.h"
+
+namespace {
+
+const std::size_t kDefaultSizes[] = { 1000000, 10000000, 50000000 };
+
+std::atomic<std::size_t> g_allocated(0);
+
+// 只记录申请的字节数，分配本身交给operator new
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(std::size_t n) {
+        g_allocated.fetch_add(n * sizeof(T), std::memory_order_relaxed);
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T* p, std::size_t n) {
+        g_allocated.fetch_sub(n * sizeof(T), std::memory_order_relaxed);
+        ::operator delete(p);
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const CountingAllocator<T>&, const CountingAllocator<U>&) { return true; }
+template <typename T, typename U>
+bool operator!=(const CountingAllocator<T>&, const CountingAllocator<U>&) { return false; }
+
+using CountedString = std::basic_string<char, std::char_traits<char>, CountingAllocator<char>>;
+using StdTokenMap = std::unordered_map<int, CountedString, std::hash<int>, std::equal_to<int>,
+    CountingAllocator<std::pair<const int, CountedString>>>;
+
+struct MapResult {
+    double insert_mops = 0; // 每秒插入（百万）
+    double lookup_mops = 0; // 每秒命中的查找（百万）
+    double bytes_per_entry = 0;
+    double total_mb = 0;
+};
+
+// 第i个插入的uid：乘以奇数在32位上是双射，uid互不相同且分布打散
+int uidOf(std::size_t i)
+{
+    return static_cast<int>(static_cast<uint32_t>(i) * 2654435761u);
+}
+
+// 查找顺序与插入顺序无关，模拟登录校验的随机访问
+std::vector<uint32_t> lookupOrder(std::size_t count, std::size_t lookups)
+{
+    std::mt19937_64 rng(7);
+    std::vector<uint32_t> order(lookups);
+    for (auto& index : order) {
+        index = static_cast<uint32_t>(rng() % count);
+    }
+    return order;
+}
+
+MapResult runFlat(std::size_t count, const std::vector<uint32_t>& order)
+{
+    MapResult result;
+    FlatHashMap<int, TokenBytes> map;
+    TokenBytes token;
+    TokenGenerator::NextBytes(token);
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        token.data[0] = static_cast<uint8_t>(i);
+        map.InsertOrAssign(uidOf(i), token);
+    }
+    result.insert_mops = count / (ElapsedNs(start) / 1e3);
+
+    std::size_t hits = 0;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t index : order) {
+        auto* found = map.Find(uidOf(index));
+        hits += found != nullptr && found->data[0] == static_cast<uint8_t>(index);
+    }
+    result.lookup_mops = order.size() / (ElapsedNs(start) / 1e3);
+    if (hits != order.size()) {
+        std::fprintf(stderr, "FlatHashMap查找结果不对: %zu/%zu\n", hits, order.size());
+    }
+
+    result.total_mb = map.MemoryUsage() / 1048576.0;
+    result.bytes_per_entry = static_cast<double>(map.MemoryUsage()) / count;
+    return result;
+}
+
+MapResult runStd(std::size_t count, const std::vector<uint32_t>& order)
+{
+    MapResult result;
+    std::size_t base = g_allocated.load();
+    {
+        StdTokenMap map;
+        // 改造前的令牌是UUID文本，超出短字符串优化的长度，每个值都有一块单独的堆内存
+        TokenBytes bytes;
+        TokenGenerator::NextBytes(bytes);
+        CountedString token(TokenGenerator::ToString(bytes).c_str());
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < count; ++i) {
+            token[0] = static_cast<char>('a' + i % 16);
+            map[uidOf(i)] = token;
+        }
+        result.insert_mops = count / (ElapsedNs(start) / 1e3);
+
+        std::size_t hits = 0;
+        start = std::chrono::steady_clock::now();
+        for (uint32_t index : order) {
+            auto iter = map.find(uidOf(index));
+            hits += iter != map.end() && iter->second[0] == static_cast<char>('a' + index % 16);
+        }
+        result.lookup_mops = order.size() / (ElapsedNs(start) / 1e3);
+        if (hits != order.size()) {
+            std::fprintf(stderr, "unordered_map查找结果不对: %zu/%zu\n", hits, order.size());
+        }
+
+        std::size_t bytes_used = g_allocated.load() - base;
+        result.total_mb = bytes_used / 1048576.0;
+        result.bytes_per_entry = static_cast<double>(bytes_used) / count;
+    }
+    return result;
+}
+
+void print(const char* name, std::size_t count, const MapResult& result)
+{
+    std::printf("%-14s %10zu %12.2f %12.2f %12.1f %10.1f\n",
+        name, count, result.insert_mops, result.lookup_mops, result.total_mb, result.bytes_per_entry);
+}
+
+}
+
+int RunFlatMapBench(int argc, char* argv[])
+{
+    bool run_flat = true;
+    bool run_std = true;
+    if (argc >= 1 && (std::strcmp(argv[0], "flat") == 0 || std::strcmp(argv[0], "std") == 0
+        || std::strcmp(argv[0], "both") == 0)) {
+        run_flat = std::strcmp(argv[0], "std") != 0;
+        run_std = std::strcmp(argv[0], "flat") != 0;
+        --argc;
+        ++argv;
+    }
+    std::vector<std::size_t> sizes;
+    for (int i = 0; i < argc; ++i) {
+        long long size = std::atoll(argv[i]);
+        if (size > 0) {
+            sizes.push_back(static_cast<std::size_t>(size));
+        }
+    }
+    if (sizes.empty()) {
+        sizes.assign(std::begin(kDefaultSizes), std::end(kDefaultSizes));
+    }
+
+    std::printf("%-14s %10s %12s %12s %12s %10s\n", "容器", "条目数", "插入M/s", "查找M/s", "内存MB", "字节/条");
+    for (std::size_t count : sizes) {
+        // 查找次数固定为条目数和10M中较小的一个，大表下也不会跑太久
+        auto order = lookupOrder(count, std::min<std::size_t>(count, 10000000));
+        if (run_flat) {
+            print("FlatHashMap", count, runFlat(count, order));
+        }
+        if (run_std) {
+            print("unordered_map", count, runStd(count, order));
+        }
+    }
+    return 0;
+}
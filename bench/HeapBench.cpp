@@ -0,0 +1,102 @@
+// heap子命令：最少连接策略下AddConnections和选择的耗时，对照改造前遍历服务器列表找最小值的做法
+// 每轮随机挑一台服务器加一或减一（保持负载大致不变），再选一次当前最空闲的服务器
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "ChatServerRegistry.h"
+#include "StatusBench.h"
+
+namespace {
+
+const std::size_t kServerCounts[] = { 10, 100, 1000 };
+
+struct HeapResult {
+    double add_ns = 0;    // 一次AddConnections，包含堆的上浮或下沉
+    double select_ns = 0; // 一次SelectLeastLoaded，直接读取堆顶
+    double scan_ns = 0;   // 在快照上线性扫描找最小连接数
+};
+
+// 改造前getChatServer的做法：每次遍历全部服务器
+std::shared_ptr<ChatServer> scanLeast(const ChatServerSnapshot& snapshot)
+{
+    std::shared_ptr<ChatServer> least;
+    int least_count = 0;
+    for (const auto& server : snapshot.servers) {
+        int count = server->con_count.load(std::memory_order_relaxed);
+        if (!least || count < least_count) {
+            least = server;
+            least_count = count;
+        }
+    }
+    return least;
+}
+
+HeapResult run(std::size_t serverCount, int iterations)
+{
+    ChatServerRegistry registry;
+    registry.SetPolicy(BalancePolicy::LeastConnections);
+    for (std::size_t i = 0; i < serverCount; ++i) {
+        registry.Add("chatserver" + std::to_string(i), "127.0.0.1", std::to_string(8090 + i));
+    }
+    auto snapshot = registry.Snapshot();
+    const auto& servers = snapshot->servers;
+
+    // 先给每台服务器一个随机的初始负载，堆里的键互不相同
+    std::mt19937_64 rng(42);
+    for (const auto& server : servers) {
+        registry.AddConnections(server, static_cast<int>(rng() % 10000) + 1000);
+    }
+
+    // 预先生成下标和增量，计时循环里只剩被测的调用
+    std::vector<std::size_t> indexes(iterations);
+    std::vector<int> deltas(iterations);
+    for (int i = 0; i < iterations; ++i) {
+        indexes[i] = static_cast<std::size_t>(rng() % serverCount);
+        deltas[i] = (rng() & 1) ? 1 : -1;
+    }
+
+    HeapResult result;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        registry.AddConnections(servers[indexes[i]], deltas[i]);
+    }
+    result.add_ns = ElapsedNs(start) / iterations;
+
+    // 选择结果累加到一个值里，避免被优化掉
+    uintptr_t sink = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        sink += reinterpret_cast<uintptr_t>(registry.SelectLeastLoaded().get());
+    }
+    result.select_ns = ElapsedNs(start) / iterations;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        sink += reinterpret_cast<uintptr_t>(scanLeast(*registry.Snapshot()).get());
+    }
+    result.scan_ns = ElapsedNs(start) / iterations;
+
+    if (sink == 1) {
+        std::printf("\n");
+    }
+    return result;
+}
+
+}
+
+int RunHeapBench(int argc, char* argv[])
+{
+    int iterations = argc >= 1 ? std::max(1, std::atoi(argv[0])) : 2000000;
+    std::printf("最少连接策略，每项 %d 次\n", iterations);
+    std::printf("%8s %14s %12s %12s\n", "服务器", "AddConnections", "堆顶选择", "线性扫描");
+    for (std::size_t servers : kServerCounts) {
+        auto result = run(servers, iterations);
+        std::printf("%8zu %12.1fns %10.1fns %10.1fns\n", servers, result.add_ns, result.select_ns, result.scan_ns);
+    }
+    return 0;
+}
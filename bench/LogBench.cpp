@@ -0,0 +1,103 @@
+// log子命令：同一批LOGF_INFO日志在文本格式和二进制格式下的写入耗时和吞吐
+// AsyncLogger是单例，格式在构造时从config.ini读取，所以每次只测一种格式：
+// 在临时目录里生成只含[Log]段的config.ini并切换过去，文本日志的标准输出也重定向到那里的文件，
+// 两种格式都写到磁盘文件上，比较的是后台线程的格式化和写出开销。
+// 每个线程的环形缓冲按每线程条数设置（每条约256字节），测量期间不丢日志，
+// 否则丢弃的日志不经过格式化和写出，会让两种格式的数字都偏好
+// 用法：log text|binary [每线程条数] [线程数]，结果输出到标准错误
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include "AsyncLogger.h"
+#include "CoarseClock.h"
+#include "LogFormat.h"
+#include "StatusBench.h"
+
+namespace {
+
+bool prepareDirectory(const std::string& format, int ringSize, boost::filesystem::path& dir)
+{
+    dir = boost::filesystem::temp_directory_path() / ("status-bench-log-" + format);
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(dir, ec);
+    boost::filesystem::create_directories(dir, ec);
+    if (ec) {
+        return false;
+    }
+    std::ofstream config((dir / "config.ini").string());
+    config << "[Log]\nLevel = info\nFlushMs = 10\nRingSize = " << ringSize
+        << "\nFormat = " << format << "\nBinaryPath = status.blog\n";
+    return static_cast<bool>(config);
+}
+
+// 与服务里分配聊天服务器时的日志参数相近：两个字符串、一个端口和两个整数
+void produce(int thread, int count)
+{
+    const std::string name = "chatserver" + std::to_string(thread);
+    const std::string host = "127.0.0.1";
+    for (int i = 0; i < count; ++i) {
+        LOGF_INFO("分配聊天服务器: {} (地址: {}:{})，用户ID: {}，当前连接数: {}", name, host, 8090 + thread, i, i % 5000);
+    }
+}
+
+}
+
+int RunLogBench(int argc, char* argv[])
+{
+    if (argc < 1 || (std::strcmp(argv[0], "text") != 0 && std::strcmp(argv[0], "binary") != 0)) {
+        std::fprintf(stderr, "用法: log text|binary [每线程条数] [线程数]\n");
+        return 2;
+    }
+    std::string format = argv[0];
+    int count = argc >= 2 ? std::max(1, std::atoi(argv[1])) : 200000;
+    int threads = argc >= 3 ? std::max(1, std::atoi(argv[2]))
+        : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    boost::filesystem::path dir;
+    if (!prepareDirectory(format, count, dir)) {
+        std::fprintf(stderr, "无法准备临时目录\n");
+        return 1;
+    }
+    boost::filesystem::current_path(dir);
+    if (!std::freopen("status.log", "w", stdout)) {
+        std::fprintf(stderr, "无法重定向标准输出\n");
+        return 1;
+    }
+
+    CoarseClock::Start(std::chrono::milliseconds(10));
+    auto logger = AsyncLogger::GetInstance();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([t, count]() { produce(t, count); });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double produce_ns = ElapsedNs(start);
+    // Stop写完缓冲里剩下的日志才返回，到这里为止是全部落盘的时间
+    logger->Stop();
+    double total_ns = ElapsedNs(start);
+    CoarseClock::Stop();
+    std::fflush(stdout);
+
+    boost::system::error_code ec;
+    auto file = dir / (format == "binary" ? "status.blog" : "status.log");
+    auto bytes = boost::filesystem::file_size(file, ec);
+    double records = static_cast<double>(threads) * count;
+    double written = records - static_cast<double>(logger->Dropped());
+    std::fprintf(stderr, "格式 %s，%d 个线程，每线程 %d 条\n", format.c_str(), threads, count);
+    std::fprintf(stderr, "写日志调用     %8.1f ns/条\n", produce_ns / records);
+    std::fprintf(stderr, "写出吞吐       %8.2f 百万条/秒（含后台线程写完）\n", written / (total_ns / 1e3));
+    std::fprintf(stderr, "丢弃           %8.0f 条\n", records - written);
+    std::fprintf(stderr, "文件大小       %8.1f MB，%.1f 字节/条\n", bytes / 1048576.0, written > 0 ? bytes / written : 0.0);
+    std::fprintf(stderr, "日志文件 %s\n", file.string().c_str());
+    return 0;
+}
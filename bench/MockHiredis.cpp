@@ -0,0 +1,152 @@
+#include "MockHiredis.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <boost/asio.hpp>
+
+namespace {
+
+struct MockConnection {
+    boost::asio::io_context ioc;
+    boost::asio::ip::tcp::socket socket;
+    std::string output; // 已追加还没发出的命令
+    std::string input;  // 已读到还没消费的回复
+
+    MockConnection() : socket(ioc) {}
+};
+
+MockConnection* connectionOf(redisContext* c)
+{
+    return static_cast<MockConnection*>(c->impl);
+}
+
+// 按hiredis的规则把格式串拆成参数，再编码成RESP数组
+void formatCommand(MockConnection* connection, const char* format, va_list ap)
+{
+    std::vector<std::string> args;
+    std::string current;
+    bool touched = false;
+    for (const char* p = format; *p != '\0'; ++p) {
+        if (*p == ' ') {
+            if (touched) {
+                args.push_back(current);
+            }
+            current.clear();
+            touched = false;
+            continue;
+        }
+        touched = true;
+        if (*p == '%' && p[1] == 's') {
+            current += va_arg(ap, const char*);
+            ++p;
+        }
+        else if (*p == '%' && p[1] == 'd') {
+            current += std::to_string(va_arg(ap, int));
+            ++p;
+        }
+        else {
+            current += *p;
+        }
+    }
+    if (touched) {
+        args.push_back(current);
+    }
+
+    connection->output += "*" + std::to_string(args.size()) + "\r\n";
+    for (const auto& arg : args) {
+        connection->output += "$" + std::to_string(arg.size()) + "\r\n" + arg + "\r\n";
+    }
+}
+
+void setError(redisContext* c, const std::string& message)
+{
+    c->err = 1;
+    std::snprintf(c->errstr, sizeof(c->errstr), "%s", message.c_str());
+}
+
+}
+
+redisContext* redisConnect(const char* ip, int port)
+{
+    auto* c = new redisContext();
+    auto* connection = new MockConnection();
+    c->impl = connection;
+    boost::system::error_code ec;
+    auto address = boost::asio::ip::make_address(ip, ec);
+    if (!ec) {
+        connection->socket.connect(boost::asio::ip::tcp::endpoint(address, static_cast<unsigned short>(port)), ec);
+    }
+    if (ec) {
+        setError(c, ec.message());
+        return c;
+    }
+    connection->socket.set_option(boost::asio::ip::tcp::no_delay(true), ec);
+    return c;
+}
+
+void redisFree(redisContext* c)
+{
+    delete connectionOf(c);
+    delete c;
+}
+
+int redisAppendCommand(redisContext* c, const char* format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+    formatCommand(connectionOf(c), format, ap);
+    va_end(ap);
+    return REDIS_OK;
+}
+
+int redisGetReply(redisContext* c, void** reply)
+{
+    auto* connection = connectionOf(c);
+    boost::system::error_code ec;
+    // 和hiredis一样，第一次取回复时才把缓冲的命令一次写出
+    if (!connection->output.empty()) {
+        boost::asio::write(connection->socket, boost::asio::buffer(connection->output), ec);
+        connection->output.clear();
+        if (ec) {
+            setError(c, ec.message());
+            return REDIS_ERR;
+        }
+    }
+
+    std::size_t end;
+    char buffer[64 * 1024];
+    while ((end = connection->input.find("\r\n")) == std::string::npos) {
+        std::size_t n = connection->socket.read_some(boost::asio::buffer(buffer), ec);
+        if (ec) {
+            setError(c, ec.message());
+            return REDIS_ERR;
+        }
+        connection->input.append(buffer, n);
+    }
+
+    auto* result = static_cast<redisReply*>(std::calloc(1, sizeof(redisReply)));
+    result->type = connection->input[0] == '-' ? REDIS_REPLY_ERROR : REDIS_REPLY_STATUS;
+    connection->input.erase(0, end + 2);
+    *reply = result;
+    return REDIS_OK;
+}
+
+void* redisCommand(redisContext* c, const char* format, ...)
+{
+    va_list ap;
+    va_start(ap, format);
+    formatCommand(connectionOf(c), format, ap);
+    va_end(ap);
+    void* reply = nullptr;
+    if (redisGetReply(c, &reply) != REDIS_OK) {
+        return nullptr;
+    }
+    return reply;
+}
+
+void freeReplyObject(void* reply)
+{
+    std::free(reply);
+}
@@ -0,0 +1,34 @@
+#pragma once
+// hiredis的最小替身，只实现redis子命令用到的函数，名字和返回约定与hiredis一致。
+// 开启STATUS_BENCH_MOCK_HIREDIS时代替hiredis链接，用于没有安装hiredis的环境；
+// 回复只区分状态和错误，不解析内容，所以只能配合内置的模拟服务器或只发SET的场景使用
+#include <cstddef>
+
+#define REDIS_OK 0
+#define REDIS_ERR -1
+
+#define REDIS_REPLY_STATUS 5
+#define REDIS_REPLY_ERROR 6
+
+typedef struct redisReply {
+    int type;
+    long long integer;
+    std::size_t len;
+    char* str;
+    std::size_t elements;
+    struct redisReply** element;
+} redisReply;
+
+typedef struct redisContext {
+    int err;
+    char errstr[128];
+    void* impl; // 连接和收发缓冲，调用方不使用
+} redisContext;
+
+redisContext* redisConnect(const char* ip, int port);
+void redisFree(redisContext* c);
+void* redisCommand(redisContext* c, const char* format, ...);
+// 只支持%s和%d，参数之间以空格分隔，与bench里的命令格式一致
+int redisAppendCommand(redisContext* c, const char* format, ...);
+int redisGetReply(redisContext* c, void** reply);
+void freeReplyObject(void* reply);
@@ -0,0 +1,242 @@
+// redis子命令：比较逐条SET和RedisTokenStore使用的流水线批量SET的吞吐
+// 用法：redis <host> <port>         连接真实的Redis
+//       redis mock [往返延迟微秒]    启动内置的模拟服务器，每次读到数据后先等待一个往返延迟再对每条命令回复+OK，
+//                                     用来在没有Redis的环境下估算网络往返对两种写法的影响
+// 没有安装hiredis时可以打开STATUS_BENCH_MOCK_HIREDIS，改用bench/MockHiredis中的最小客户端，
+// 这时只适合配合mock使用，测得的是两种写法的往返次数差异，不代表真实Redis和hiredis的吞吐
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/asio.hpp>
+#include "StatusBench.h"
+#include "const.h"
+#ifdef STATUS_BENCH_MOCK_HIREDIS
+#include "MockHiredis.h"
+#else
+#include "hiredis/hiredis.h"
+#endif
+
+namespace {
+
+const std::size_t kBatchSizes[] = { 1, 16, 64, 512 };
+const int kTtlSeconds = 86400;
+
+// 只解析客户端发来的RESP数组命令，统计条数，不保存数据
+class MockRedis
+{
+public:
+    explicit MockRedis(int rttMicros)
+        : _acceptor(_ioc, boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0)),
+        _rtt(rttMicros), _b_stop(false)
+    {
+        _thread = std::thread([this]() { run(); });
+    }
+    ~MockRedis() {
+        _b_stop = true;
+        // accept是阻塞调用，自己连一次让它返回
+        boost::system::error_code ec;
+        boost::asio::ip::tcp::socket wake(_ioc);
+        wake.connect(_acceptor.local_endpoint(), ec);
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+    }
+
+    int Port() const { return _acceptor.local_endpoint().port(); }
+
+private:
+    void run() {
+        while (!_b_stop) {
+            boost::asio::ip::tcp::socket socket(_ioc);
+            boost::system::error_code ec;
+            _acceptor.accept(socket, ec);
+            if (ec || _b_stop) {
+                return;
+            }
+            socket.set_option(boost::asio::ip::tcp::no_delay(true), ec);
+            serve(socket);
+        }
+    }
+
+    // 一次只服务一条连接，测试客户端也只用一条连接
+    void serve(boost::asio::ip::tcp::socket& socket) {
+        std::string pending;
+        std::string replies;
+        char buffer[64 * 1024];
+        boost::system::error_code ec;
+        while (true) {
+            std::size_t n = socket.read_some(boost::asio::buffer(buffer), ec);
+            if (ec) {
+                return;
+            }
+            pending.append(buffer, n);
+            std::size_t commands = consume(pending);
+            if (commands == 0) {
+                continue;
+            }
+            if (_rtt > 0) {
+                std::this_thread::sleep_for(std::chrono::microseconds(_rtt));
+            }
+            replies.clear();
+            for (std::size_t i = 0; i < commands; ++i) {
+                replies.append("+OK\r\n");
+            }
+            boost::asio::write(socket, boost::asio::buffer(replies), ec);
+            if (ec) {
+                return;
+            }
+        }
+    }
+
+    // 从缓冲开头去掉完整的命令，返回条数；不完整的命令留到下次
+    static std::size_t consume(std::string& data) {
+        std::size_t count = 0;
+        std::size_t pos = 0;
+        while (true) {
+            std::size_t next = parseCommand(data, pos);
+            if (next == std::string::npos) {
+                break;
+            }
+            pos = next;
+            ++count;
+        }
+        data.erase(0, pos);
+        return count;
+    }
+
+    static std::size_t parseLength(const std::string& data, std::size_t& pos, char type) {
+        if (pos >= data.size() || data[pos] != type) {
+            return std::string::npos;
+        }
+        std::size_t end = data.find("\r\n", pos);
+        if (end == std::string::npos) {
+            return std::string::npos;
+        }
+        std::size_t value = std::strtoull(data.c_str() + pos + 1, nullptr, 10);
+        pos = end + 2;
+        return value;
+    }
+
+    static std::size_t parseCommand(const std::string& data, std::size_t pos) {
+        std::size_t args = parseLength(data, pos, '*');
+        if (args == std::string::npos) {
+            return std::string::npos;
+        }
+        for (std::size_t i = 0; i < args; ++i) {
+            std::size_t length = parseLength(data, pos, '$');
+            if (length == std::string::npos || data.size() - pos < length + 2) {
+                return std::string::npos;
+            }
+            pos += length + 2;
+        }
+        return pos;
+    }
+
+    boost::asio::io_context _ioc;
+    boost::asio::ip::tcp::acceptor _acceptor;
+    int _rtt;
+    std::atomic<bool> _b_stop;
+    std::thread _thread;
+};
+
+std::string keyOf(int uid)
+{
+    return USERTOKENPREFIX + std::to_string(uid);
+}
+
+// 逐条SET，每条等一次回复，返回每秒写入的令牌数
+double runSingle(redisContext* context, int count, const std::string& token)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int uid = 0; uid < count; ++uid) {
+        auto* reply = static_cast<redisReply*>(redisCommand(context, "SET %s %s EX %d",
+            keyOf(uid).c_str(), token.c_str(), kTtlSeconds));
+        if (reply == nullptr) {
+            return 0;
+        }
+        freeReplyObject(reply);
+    }
+    return count / (ElapsedNs(start) / 1e9);
+}
+
+// 与RedisMgr::SetBatch相同：先追加一批命令，再依次读回复
+double runPipelined(redisContext* context, int count, std::size_t batch, const std::string& token)
+{
+    auto start = std::chrono::steady_clock::now();
+    int uid = 0;
+    while (uid < count) {
+        int end = std::min<int>(count, uid + static_cast<int>(batch));
+        for (int i = uid; i < end; ++i) {
+            redisAppendCommand(context, "SET %s %s EX %d", keyOf(i).c_str(), token.c_str(), kTtlSeconds);
+        }
+        for (int i = uid; i < end; ++i) {
+            redisReply* reply = nullptr;
+            if (redisGetReply(context, reinterpret_cast<void**>(&reply)) != REDIS_OK || reply == nullptr) {
+                return 0;
+            }
+            freeReplyObject(reply);
+        }
+        uid = end;
+    }
+    return count / (ElapsedNs(start) / 1e9);
+}
+
+}
+
+int RunRedisPipelineBench(int argc, char* argv[])
+{
+    if (argc < 1) {
+        std::fprintf(stderr, "用法: redis <host> <port> | redis mock [往返延迟微秒]\n");
+        return 2;
+    }
+    std::unique_ptr<MockRedis> mock;
+    std::string host;
+    int port = 0;
+    if (std::strcmp(argv[0], "mock") == 0) {
+        int rtt = argc >= 2 ? std::max(0, std::atoi(argv[1])) : 200;
+        mock.reset(new MockRedis(rtt));
+        host = "127.0.0.1";
+        port = mock->Port();
+        std::printf("模拟Redis，往返延迟 %d 微秒\n", rtt);
+    }
+    else {
+        if (argc < 2) {
+            std::fprintf(stderr, "用法: redis <host> <port>\n");
+            return 2;
+        }
+        host = argv[0];
+        port = std::atoi(argv[1]);
+        std::printf("Redis %s:%d\n", host.c_str(), port);
+    }
+
+    redisContext* context = redisConnect(host.c_str(), port);
+    if (context == nullptr || context->err) {
+        std::fprintf(stderr, "连接失败: %s\n", context ? context->errstr : "无法分配连接");
+        if (context) {
+            redisFree(context);
+        }
+        return 1;
+    }
+
+    const std::string token = "00000000-0000-4000-8000-000000000000";
+    // 逐条写入太慢，少写一些
+    const int single_count = 2000;
+    const int batch_count = 50000;
+    double single = runSingle(context, single_count, token);
+    std::printf("%-10s %14s %10s\n", "写法", "令牌/秒", "倍数");
+    std::printf("%-10s %14.0f %10.2f\n", "逐条SET", single, 1.0);
+    for (std::size_t batch : kBatchSizes) {
+        double rate = runPipelined(context, batch_count, batch, token);
+        char name[32];
+        std::snprintf(name, sizeof(name), "批量%zu", batch);
+        std::printf("%-10s %14.0f %10.2f\n", name, rate, single > 0 ? rate / single : 0.0);
+    }
+    redisFree(context);
+    return 0;
+}
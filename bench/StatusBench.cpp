@@ -0,0 +1,44 @@
+// status-bench：负载均衡策略模拟和令牌存储等模块的性能测试
+// 直接链接服务中的实现，不需要启动gRPC服务，也不连接数据库
+// 用法：status-bench <子命令> [参数...]
+#include <cstdio>
+#include <cstring>
+#include "StatusBench.h"
+
+namespace {
+
+struct Command {
+    const char* name;
+    const char* usage;
+    int (*run)(int argc, char* argv[]);
+};
+
+const Command kCommands[] = {
+    { "balance", "balance [每台会话数]    模拟random、round-robin、least、p2c在2~500台服务器下的负载分布和选择耗时", RunBalanceSim },
+    { "tokens", "tokens [每线程操作数]    ShardedTokenStore在不同分片数、线程数下的写入+校验吞吐", RunTokenStoreBench },
+    { "redis", "redis <host> <port> | redis mock [往返延迟微秒]    逐条SET与流水线批量SET的吞吐", RunRedisPipelineBench },
+    { "heap", "heap [每项次数]    最少连接策略在10、100、1000台服务器下AddConnections和选择的耗时", RunHeapBench },
+    { "batch", "batch [每线程uid数] [线程数]    批量分配（AssignBatch + InsertBatch）在批大小1~256下每个uid的耗时", RunBatchAssignBench },
+    { "tokengen", "tokengen [每线程令牌数]    TokenGenerator与boost uuid生成文本令牌的耗时", RunTokenGenBench },
+    { "flatmap", "flatmap [flat|std|both] [条目数...]    FlatHashMap与unordered_map<int, string>在1M、10M、50M条目下的插入、查找速率和内存", RunFlatMapBench },
+    { "snapshot", "snapshot [令牌数] [快照路径]    10M令牌下写快照、mmap恢复与重新插入的耗时", RunSnapshotBench },
+    { "log", "log text|binary [每线程条数] [线程数]    文本日志与二进制日志的写入耗时和吞吐", RunLogBench },
+};
+
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc >= 2) {
+        for (const auto& command : kCommands) {
+            if (std::strcmp(argv[1], command.name) == 0) {
+                return command.run(argc - 2, argv + 2);
+            }
+        }
+    }
+    std::fprintf(stderr, "用法: %s <子命令> [参数...]\n", argv[0]);
+    for (const auto& command : kCommands) {
+        std::fprintf(stderr, "  %s\n", command.usage);
+    }
+    return 2;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <chrono>
+
+// status-bench的子命令，各自解析自己的参数，返回进程退出码
+int RunBalanceSim(int argc, char* argv[]);
+int RunTokenStoreBench(int argc, char* argv[]);
+int RunRedisPipelineBench(int argc, char* argv[]);
+int RunHeapBench(int argc, char* argv[]);
+int RunBatchAssignBench(int argc, char* argv[]);
+int RunTokenGenBench(int argc, char* argv[]);
+int RunFlatMapBench(int argc, char* argv[]);
+int RunSnapshotBench(int argc, char* argv[]);
+int RunLogBench(int argc, char* argv[]);
+
+// 从start到现在经过的纳秒数
+inline double ElapsedNs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
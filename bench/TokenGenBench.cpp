@@ -0,0 +1,104 @@
+// tokengen子命令：每生成一个文本令牌的耗时和多线程吞吐
+// 对照改造前的写法：每次调用构造boost::uuids::random_generator（从系统熵源播种），再用to_string转文本；
+// 另列出生成器复用时boost的耗时，区分播种开销和生成本身
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/uuid/uuid.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include "StatusBench.h"
+#include "TokenGenerator.h"
+
+namespace {
+
+enum class Generator { Buffered, BoostPerCall, BoostReused };
+
+struct GeneratorInfo {
+    Generator generator;
+    const char* name;
+};
+
+const GeneratorInfo kGenerators[] = {
+    { Generator::Buffered, "TokenGenerator" },
+    { Generator::BoostPerCall, "boost每次构造" },
+    { Generator::BoostReused, "boost复用" },
+};
+
+// 每个线程生成count个文本令牌，长度累加到sink里避免被优化掉
+std::size_t generate(Generator generator, int count)
+{
+    std::size_t sink = 0;
+    switch (generator) {
+    case Generator::Buffered: {
+        TokenBytes bytes;
+        for (int i = 0; i < count; ++i) {
+            TokenGenerator::NextBytes(bytes);
+            sink += TokenGenerator::ToString(bytes).size();
+        }
+        break;
+    }
+    case Generator::BoostPerCall:
+        for (int i = 0; i < count; ++i) {
+            boost::uuids::uuid uuid = boost::uuids::random_generator()();
+            sink += boost::uuids::to_string(uuid).size();
+        }
+        break;
+    case Generator::BoostReused: {
+        boost::uuids::random_generator gen;
+        for (int i = 0; i < count; ++i) {
+            sink += boost::uuids::to_string(gen()).size();
+        }
+        break;
+    }
+    }
+    return sink;
+}
+
+// 返回每秒生成的令牌数（百万）
+double run(Generator generator, int threads, int count)
+{
+    std::vector<std::thread> workers;
+    std::vector<std::size_t> sinks(threads);
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&sinks, generator, t, count]() {
+            sinks[t] = generate(generator, count);
+            });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = ElapsedNs(start) / 1e9;
+    for (std::size_t sink : sinks) {
+        if (sink != static_cast<std::size_t>(count) * TokenGenerator::kTextLength) {
+            std::fprintf(stderr, "令牌长度不对\n");
+        }
+    }
+    return static_cast<double>(threads) * count / seconds / 1e6;
+}
+
+}
+
+int RunTokenGenBench(int argc, char* argv[])
+{
+    int count = argc >= 1 ? std::max(1, std::atoi(argv[0])) : 200000;
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> thread_counts = { 1 };
+    if (cores > 1) {
+        thread_counts.push_back(static_cast<int>(cores));
+    }
+
+    std::printf("CPU核数 %u，每线程 %d 个令牌\n", cores, count);
+    std::printf("%-16s %6s %12s %10s\n", "生成方式", "线程", "百万个/秒", "ns/个");
+    for (const auto& info : kGenerators) {
+        for (int threads : thread_counts) {
+            double rate = run(info.generator, threads, count);
+            std::printf("%-16s %6d %12.2f %10.1f\n", info.name, threads, rate, threads * 1e3 / rate);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// tokens子命令：ShardedTokenStore在不同分片数和线程数下的吞吐
+// 每个线程模拟GetChatServer + Login：生成令牌、写入、再校验，uid互不重叠，
+// 分片数为1时所有线程争同一把锁，相当于改造前的单表加全局锁
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ShardedTokenStore.h"
+#include "StatusBench.h"
+#include "const.h"
+
+namespace {
+
+const std::size_t kShardCounts[] = { 1, 16, 64 };
+
+// 返回每秒完成的“写入+校验”对数（百万）
+double run(std::size_t shards, int threads, int opsPerThread)
+{
+    // 与默认配置一样带有效期，写入时包含挂时间轮的开销
+    ShardedTokenStore store(shards, 86400);
+    std::vector<std::thread> workers;
+    int failures = 0;
+    std::mutex failure_mutex;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&store, &failures, &failure_mutex, t, opsPerThread]() {
+            int local_failures = 0;
+            TokenBytes token;
+            for (int i = 0; i < opsPerThread; ++i) {
+                int uid = t * opsPerThread + i;
+                TokenGenerator::NextBytes(token);
+                store.Insert(uid, token);
+                if (store.Verify(uid, token) != ErrorCodes::SUCCESS) {
+                    ++local_failures;
+                }
+            }
+            std::lock_guard<std::mutex> guard(failure_mutex);
+            failures += local_failures;
+            });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double seconds = ElapsedNs(start) / 1e9;
+    if (failures > 0) {
+        std::fprintf(stderr, "校验失败 %d 次\n", failures);
+    }
+    return static_cast<double>(threads) * opsPerThread / seconds / 1e6;
+}
+
+}
+
+int RunTokenStoreBench(int argc, char* argv[])
+{
+    int ops = argc >= 1 ? std::max(1, std::atoi(argv[0])) : 500000;
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<int> thread_counts;
+    for (int threads = 1; threads <= static_cast<int>(cores) * 2 && threads <= 64; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    if (thread_counts.size() < 2) {
+        thread_counts.push_back(2);
+    }
+
+    std::printf("CPU核数 %u，每线程 %d 次写入+校验\n", cores, ops);
+    std::printf("%6s %6s %12s %8s\n", "分片", "线程", "百万对/秒", "加速比");
+    for (std::size_t shards : kShardCounts) {
+        double base = 0;
+        for (int threads : thread_counts) {
+            double rate = run(shards, threads, ops);
+            if (threads == 1) {
+                base = rate;
+            }
+            std::printf("%6zu %6d %12.2f %8.2f\n", shards, threads, rate, base > 0 ? rate / base : 0.0);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,243 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "Singleton.h"
+
+// 日志级别，WARN及以上输出到标准错误，其余输出到标准输出
+enum class LogLevel : uint8_t {
+    Debug = 0,
+    Info = 1,
+    Warn = 2,
+    Error = 3,
+    Off = 4, // 只用于设置级别，关闭全部日志
+};
+
+// 编译期最低级别，低于它的日志语句整条被编译器去掉，参数也不会求值
+// Release构建默认去掉DEBUG日志，可以在预处理器定义里覆盖
+#ifndef STATUS_LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define STATUS_LOG_MIN_LEVEL 1
+#else
+#define STATUS_LOG_MIN_LEVEL 0
+#endif
+#endif
+
+constexpr bool LogCompiledIn(LogLevel level)
+{
+    return level >= static_cast<LogLevel>(STATUS_LOG_MIN_LEVEL);
+}
+
+// 定长日志记录，生产者直接在环形缓冲的槽位里格式化，不分配内存
+// 超过kTextSize的部分被截断，输出时以"..."结尾
+struct LogRecord {
+    static constexpr std::size_t kTextSize = 240;
+
+    int64_t time_ms;  // 写日志时的系统时间（毫秒），取自粗粒度时钟
+    uint16_t length;
+    LogLevel level;
+    bool truncated;
+    uint32_t format_id; // 0表示text是格式化好的文本，否则text是按LogFormat编码的参数
+    char text[kTextSize];
+};
+
+struct LogFormatEntry;
+
+// 单生产者单消费者的环形缓冲，每个写日志的线程独占一个，只有后台线程读取
+// 写入只有两次原子操作（读消费位置、发布生产位置），不加锁也不会阻塞；满了就丢弃新日志并计数
+class LogRing
+{
+public:
+    // capacity向上取整为2的幂
+    explicit LogRing(std::size_t capacity);
+    LogRing(const LogRing&) = delete;
+    LogRing& operator=(const LogRing&) = delete;
+
+    // 生产者：取下一个空槽位，缓冲已满或本线程正在写另一条时返回nullptr
+    LogRecord* Reserve() {
+        if (_writing) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        uint64_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) > _mask) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        _writing = true;
+        return &_records[head & _mask];
+    }
+    // 生产者：发布Reserve取到的槽位
+    void Commit() {
+        _writing = false;
+        _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // 消费者：依次处理已发布的记录，返回处理的条数
+    template <typename F>
+    std::size_t Drain(F consume) {
+        uint64_t tail = _tail.load(std::memory_order_relaxed);
+        uint64_t head = _head.load(std::memory_order_acquire);
+        for (uint64_t i = tail; i != head; ++i) {
+            consume(_records[i & _mask]);
+        }
+        _tail.store(head, std::memory_order_release);
+        return static_cast<std::size_t>(head - tail);
+    }
+    // 取出并清零丢弃计数
+    uint64_t TakeDropped() { return _dropped.exchange(0, std::memory_order_relaxed); }
+    bool Empty() const {
+        return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_relaxed);
+    }
+    // 所属线程退出时调用，后台线程取完剩余记录后回收
+    void Close() { _closed.store(true, std::memory_order_release); }
+    bool Closed() const { return _closed.load(std::memory_order_acquire); }
+
+private:
+    alignas(64) std::atomic<uint64_t> _head; // 只由生产者写
+    alignas(64) std::atomic<uint64_t> _tail; // 只由消费者写
+    alignas(64) std::atomic<uint64_t> _dropped;
+    std::atomic<bool> _closed;
+    bool _writing; // 只由生产者访问，防止格式化参数时再写日志覆盖同一槽位
+    std::size_t _mask;
+    std::unique_ptr<LogRecord[]> _records;
+};
+
+// 异步日志
+// RPC线程把日志写进自己的环形缓冲，后台线程每隔FlushMs把所有缓冲里的记录
+// 加上时间前缀后整批写出，每批只刷新一次。缓冲满时丢弃新日志，不阻塞请求线程，
+// 丢弃的条数由后台线程输出到标准错误。Stop之后的日志直接同步输出。
+// [Log] Format = binary时记录原样追加到BinaryPath，不做文本格式化，用statuslog-decode查看；
+// WARN及以上仍然同时以文本输出到标准错误。
+class AsyncLogger : public Singleton<AsyncLogger>
+{
+    friend class Singleton<AsyncLogger>;
+public:
+    // 时间前缀"[YYYY-mm-dd HH:MM:SS] "的缓冲大小
+    static constexpr std::size_t kPrefixSize = 24;
+
+    ~AsyncLogger();
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    // 运行期级别，低于它的日志在求值参数之前就被跳过；任何线程随时可以切换，
+    // 运维通过StatusService的SetLogLevel RPC调用SetLevel
+    static bool Enabled(LogLevel level) {
+        return static_cast<uint8_t>(level) >= _level.load(std::memory_order_relaxed);
+    }
+    static void SetLevel(LogLevel level) { _level.store(static_cast<uint8_t>(level), std::memory_order_relaxed); }
+    static LogLevel Level() { return static_cast<LogLevel>(_level.load(std::memory_order_relaxed)); }
+    // 解析debug、info、warn、error、off（不区分大小写），无法识别时返回false
+    static bool ParseLevel(const std::string& text, LogLevel& level);
+    // 级别的小写名称，与ParseLevel接受的写法一致
+    static const char* LevelName(LogLevel level);
+
+    // 当前线程的环形缓冲，首次调用时创建并登记；日志已停止时返回nullptr
+    static LogRing* ThreadRing();
+    // 同步以文本写出一条记录，Stop之后使用
+    static void WriteDirect(const LogRecord& record);
+    // 写出缓冲中剩余的日志并停止后台线程，在main退出前调用
+    void Stop();
+    // 启动以来因缓冲满而丢弃的日志条数
+    uint64_t Dropped() const { return _total_dropped.load(std::memory_order_relaxed); }
+
+private:
+    AsyncLogger();
+    std::shared_ptr<LogRing> registerRing();
+    void run();
+    // 取出所有缓冲中的记录追加到输出缓冲，回收已退出线程的缓冲
+    void drain();
+    void append(const LogRecord& record);
+    void appendText(const LogRecord& record, std::string& buffer);
+    void appendBinary(const LogRecord& record);
+    // 写出编号不超过id、还没写过的格式定义
+    void appendFormats(uint32_t id);
+    // 编号对应的格式，结果缓存在后台线程里
+    const LogFormatEntry* format(uint32_t id);
+
+    static std::atomic<bool> _stopped;
+    static std::atomic<uint8_t> _level;
+
+    std::size_t _ring_size;
+    std::chrono::milliseconds _flush_interval;
+    std::mutex _rings_mutex;
+    std::vector<std::shared_ptr<LogRing>> _rings;
+    std::atomic<uint64_t> _total_dropped;
+
+    // 以下只在后台线程里访问
+    std::string _out_buffer;
+    std::string _err_buffer;
+    int64_t _prefix_second; // _prefix对应的秒数
+    char _prefix[kPrefixSize];
+    std::size_t _prefix_length;
+    std::vector<const LogFormatEntry*> _formats; // 按编号缓存
+    FILE* _binary_file; // 为空表示文本格式
+    std::string _binary_buffer;
+    uint32_t _formats_written; // 已写入二进制日志的最大格式编号
+
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _b_stop;
+    std::thread _thread;
+};
+
+// 一条日志，构造时占用当前线程缓冲中的一个槽位，析构时发布
+// 拼接只做定长拷贝和数字转换，缓冲满时后续的<<都是空操作
+class LogLine
+{
+public:
+    explicit LogLine(LogLevel level);
+    ~LogLine();
+    LogLine(const LogLine&) = delete;
+    LogLine& operator=(const LogLine&) = delete;
+
+    LogLine& operator<<(const char* text);
+    LogLine& operator<<(const std::string& text);
+    LogLine& operator<<(char c);
+    LogLine& operator<<(double value);
+    template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    LogLine& operator<<(T value) {
+        if (std::is_signed<T>::value) {
+            appendSigned(static_cast<long long>(value));
+        }
+        else {
+            appendUnsigned(static_cast<unsigned long long>(value));
+        }
+        return *this;
+    }
+    // 枚举（如ErrorCodes）按数值输出
+    template <typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+    LogLine& operator<<(T value) {
+        return *this << static_cast<typename std::underlying_type<T>::type>(value);
+    }
+
+private:
+    void append(const char* data, std::size_t size);
+    void appendSigned(long long value);
+    void appendUnsigned(unsigned long long value);
+
+    LogRing* _ring;
+    LogRecord* _record; // 为空表示这条日志已被丢弃
+    std::unique_ptr<LogRecord> _direct; // 日志停止后同步输出用
+};
+
+// 用法：LOG_INFO << "收到请求，用户ID: " << uid;
+// 不需要std::endl，每条日志自动换行并带时间和级别前缀。
+// 级别判断在if里完成，被跳过时<<右边的表达式都不会求值；
+// 写成if-else的形式，放在不带花括号的if分支里也不会吞掉外层的else
+#define STATUS_LOG(level) \
+    if (!LogCompiledIn(level) || !AsyncLogger::Enabled(level)) ; \
+    else LogLine(level)
+#define LOG_DEBUG STATUS_LOG(LogLevel::Debug)
+#define LOG_INFO STATUS_LOG(LogLevel::Info)
+#define LOG_WARN STATUS_LOG(LogLevel::Warn)
+#define LOG_ERROR STATUS_LOG(LogLevel::Error)
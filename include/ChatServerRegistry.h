@@ -0,0 +1,124 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "IndexedMinHeap.h"
+#include "PhiAccrualDetector.h"
+
+// 聊天服务器信息，地址字段注册后不再改变，负载用原子变量维护
+struct ChatServer {
+    ChatServer(std::size_t id, const std::string& name, const std::string& host, const std::string& port, int weight,
+        double phiMinStdDevMs = 100.0, double acceptablePauseMs = 0.0);
+    ChatServer(const ChatServer&) = delete;
+    ChatServer& operator=(const ChatServer&) = delete;
+
+    const std::size_t id; // 注册表内唯一编号，用作堆索引
+    const std::string host;
+    const std::string port;
+    const std::string name;
+    const int weight; // 相对处理能力，来自配置Weight，默认为1
+    const uint64_t name_hash; // 服务器名的稳定哈希，供会话亲和策略计算得分
+    std::atomic<int> con_count; // 包含已分配但尚未确认的预留
+    std::atomic<int> pending_leases; // 尚未确认的预留数
+    std::atomic<bool> removed; // 已下线，之后的计数变化不再计入注册表的总连接数
+    PhiAccrualDetector detector; // 心跳到达间隔统计
+};
+
+// 某一时刻的服务器列表，发布后只读
+struct ChatServerSnapshot {
+    std::vector<std::shared_ptr<ChatServer>> servers;
+    std::unordered_map<std::string, std::shared_ptr<ChatServer>> by_name;
+    int64_t total_weight = 0;
+};
+
+// 负载均衡策略
+enum class BalancePolicy {
+    LeastConnections, // 连接数最少的，由索引堆维护，读取O(1)，连接数变化O(log n)
+    TwoChoices,       // 随机抽两台取较轻的一台，O(1)，突发流量下不会全部涌向同一台
+    WeightedLeastLoad,// 按 连接数/权重 取最小的，同样由索引堆维护
+    Affinity,         // 会话亲和：uid按加权最高随机权重（HRW）哈希到固定服务器，负载超上限时顺延
+};
+
+// 读-复制-更新（RCU）方式的聊天服务器注册表
+// 读者通过原子加载拿到当前快照，不加锁也不拷贝字符串；
+// 写者（注册、下线）复制一份新快照后原子替换，旧快照在最后一个读者释放后自动回收。
+class ChatServerRegistry
+{
+public:
+    ChatServerRegistry();
+    ChatServerRegistry(const ChatServerRegistry&) = delete;
+    ChatServerRegistry& operator=(const ChatServerRegistry&) = delete;
+
+    // 注册服务器，同名服务器已存在时返回false；weight小于1时按1处理
+    bool Add(const std::string& name, const std::string& host, const std::string& port, int weight = 1);
+    // 下线服务器，不存在时返回false
+    bool Remove(const std::string& name);
+    // 记录心跳并用上报的连接数覆盖计数，只读快照、不复制，不影响并发的选择
+    bool Heartbeat(const std::string& name, int count);
+    // phi值超过阈值的服务器名，由定时任务调用后再逐个下线
+    std::vector<std::string> CollectSuspects(double phiThreshold) const;
+    // 按策略选择服务器，没有可用服务器时返回nullptr；uid只在会话亲和策略下使用
+    std::shared_ptr<ChatServer> Select(int uid) const;
+    // 连接数（加权策略下为归一化负载）最小的服务器，直接读取堆顶
+    std::shared_ptr<ChatServer> SelectLeastLoaded() const;
+    // 随机抽两台，返回连接数较少的一台
+    std::shared_ptr<ChatServer> SelectTwoChoices() const;
+    // 有界负载的会话亲和：按HRW得分从高到低，取第一台负载不超过
+    // loadFactor * 平均负载（按权重分摊）的服务器。服务器增减时只影响原本落在它上面的uid
+    std::shared_ptr<ChatServer> SelectAffinity(int uid) const;
+    // 批量分配：为每个uid选择服务器并把其连接数加一，没有可用服务器的位置为nullptr
+    // 堆策略下整批只加一次堆锁、只发布一次堆顶，批内的分配依次计入，仍会均匀分散
+    std::vector<std::shared_ptr<ChatServer>> AssignBatch(const std::vector<int>& uids);
+    // 修改连接数，返回修改前的值；最少连接策略下同时调整堆
+    int AddConnections(const std::shared_ptr<ChatServer>& server, int delta);
+    // 用聊天服务器上报的实际连接数覆盖计数，返回覆盖前的值
+    // 上报数不含尚未连上的预留，覆盖时会把pending_leases加回去
+    int SetConnections(const std::shared_ptr<ChatServer>& server, int count);
+    std::shared_ptr<ChatServer> Find(const std::string& name) const;
+    std::shared_ptr<const ChatServerSnapshot> Snapshot() const;
+    std::size_t Size() const;
+    void Clear();
+
+    // 切换策略，会按当前服务器列表重建堆
+    void SetPolicy(BalancePolicy policy);
+    BalancePolicy Policy() const { return _policy.load(std::memory_order_relaxed); }
+    // 会话亲和策略的负载上限系数，必须大于1
+    void SetAffinityLoadFactor(double factor) { _load_factor = factor > 1.0 ? factor : 1.25; }
+    // 故障检测器的标准差下限和可容忍的心跳停顿（毫秒），只影响之后注册的服务器
+    void SetFailureDetector(double minStdDevMs, double acceptablePauseMs);
+
+private:
+    void publish(std::shared_ptr<const ChatServerSnapshot> snapshot);
+    bool heapEnabled() const {
+        auto policy = Policy();
+        return policy == BalancePolicy::LeastConnections || policy == BalancePolicy::WeightedLeastLoad;
+    }
+    // 堆中使用的键：最少连接策略为连接数，加权策略为 连接数/权重 的定点数
+    int64_t heapKey(const ChatServer& server, int count) const;
+    // 堆顶变化后重新发布，调用者需持有_heap_mutex
+    void publishLeast();
+    // 计数变化后调整堆中的位置，调用者需持有_heap_mutex
+    void updateHeap(const ChatServer& server, int count);
+    // 把计数变化计入总连接数，已下线的服务器跳过
+    void addTotal(const ChatServer& server, int64_t delta);
+
+    std::shared_ptr<const ChatServerSnapshot> _snapshot; // 只能通过std::atomic_load/atomic_store访问
+    std::mutex _writer_mutex; // 只串行化写者，读者不碰这把锁
+    std::atomic<BalancePolicy> _policy;
+    std::size_t _next_id;
+    std::atomic<int64_t> _total_connections; // 所有服务器的连接数之和
+    double _load_factor;
+    double _phi_min_std_dev;  // 受_writer_mutex保护
+    double _acceptable_pause; // 受_writer_mutex保护
+
+    // 最少连接和加权策略使用的索引堆
+    std::mutex _heap_mutex;
+    IndexedMinHeap _heap;
+    std::unordered_map<std::size_t, std::shared_ptr<ChatServer>> _heap_servers;
+    std::shared_ptr<ChatServer> _least; // 当前堆顶，只能通过std::atomic_load/atomic_store访问
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// 粗粒度时钟
+// 后台线程每隔tick刷新一次当前时间（毫秒）和格式化好的时间戳字符串，
+// 读取时只有一次原子加载，不调用system_clock::now、localtime和put_time。
+// 精度为一个tick，只用于日志时间和连接空闲判断这类不需要精确时间的地方。
+// Start之前读取时退化为直接取系统时间。
+class CoarseClock
+{
+public:
+    // "[YYYY-mm-dd HH:MM:SS]"加结尾的'\0'
+    static constexpr std::size_t kTimestampSize = 22;
+
+    // 启动刷新线程，重复调用无效
+    static void Start(std::chrono::milliseconds tick);
+    // 停止刷新线程，之后读取退化为系统时间；进程退出时也会自动停止
+    static void Stop();
+
+    // 系统时间，自1970年起的毫秒数
+    static int64_t NowMs() {
+        int64_t ms = _now_ms.load(std::memory_order_relaxed);
+        return ms != 0 ? ms : preciseNowMs();
+    }
+    static int64_t NowSeconds() { return NowMs() / 1000; }
+    // 当前时间的本地时间字符串"[YYYY-mm-dd HH:MM:SS]"
+    static void Timestamp(char (&out)[kTimestampSize]);
+    // 把秒数格式化为本地时间字符串，返回不含'\0'的长度
+    static std::size_t Format(int64_t seconds, char (&out)[kTimestampSize]);
+
+private:
+    static int64_t preciseNowMs();
+    static void refresh();
+    static void run(std::chrono::milliseconds tick);
+
+    static std::atomic<int64_t> _now_ms; // 0表示刷新线程未运行
+    // 时间戳轮流写入多个槽位再发布指针，读者拿到指针后拷贝期间不会被覆盖（除非停顿超过数秒）
+    static std::atomic<const char*> _timestamp;
+};
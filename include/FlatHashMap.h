@@ -0,0 +1,382 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FLAT_HASH_MAP_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// 整数键的默认哈希（MurmurHash3的64位终结函数）
+// 令牌分片用的是乘法散列的高位，这里换一个独立的混合函数，避免同一分片内的键哈希值扎堆
+struct FlatHash {
+    uint64_t operator()(int key) const {
+        uint64_t h = static_cast<uint32_t>(key);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+};
+
+// 开放寻址的扁平哈希表（Swiss table 结构）
+// 槽位按16个一组，每组配16个控制字节：空、已删除，或哈希值低7位。
+// 查找时用SSE2一次比较整组控制字节，只有低7位相同的槽才去比较键，
+// 键和值都内联存放在连续数组里，一次查找通常只碰一条控制字节缓存行和一条槽位缓存行。
+// 键值必须可平凡复制；本身不加锁，由使用者保证同一时间只有一个线程写。
+template <typename Key, typename Value, typename Hash = FlatHash>
+class FlatHashMap
+{
+    static_assert(std::is_trivially_copyable<Key>::value, "FlatHashMap 的键必须可平凡复制");
+    static_assert(std::is_trivially_copyable<Value>::value, "FlatHashMap 的值必须可平凡复制");
+
+public:
+    FlatHashMap() : _groups(0), _size(0), _growth_left(0) {}
+    FlatHashMap(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+    // 查找键，不存在时返回nullptr；返回的指针在下一次插入前有效
+    Value* Find(const Key& key) {
+        std::size_t index = findIndex(key);
+        return index == kNotFound ? nullptr : &_slots[index].value;
+    }
+    const Value* Find(const Key& key) const {
+        return const_cast<FlatHashMap*>(this)->Find(key);
+    }
+
+    // 插入或覆盖，返回true表示新插入
+    bool InsertOrAssign(const Key& key, const Value& value) {
+        std::size_t index = findIndex(key);
+        if (index != kNotFound) {
+            _slots[index].value = value;
+            return false;
+        }
+        if (_growth_left == 0) {
+            rehash();
+        }
+        uint64_t hash = Hash()(key);
+        index = findInsertSlot(hash);
+        if (ctrlAt(index) == kEmpty) {
+            --_growth_left; // 复用已删除的槽不占用新的增长额度
+        }
+        setCtrl(index, h2(hash));
+        _slots[index].key = key;
+        _slots[index].value = value;
+        ++_size;
+        return true;
+    }
+
+    // 删除键，返回false表示不存在
+    bool Erase(const Key& key) {
+        std::size_t index = findIndex(key);
+        if (index == kNotFound) {
+            return false;
+        }
+        eraseAt(index);
+        return true;
+    }
+
+    // CLOCK式扫描：从hand处按槽位顺序查看元素，keep(key, value)返回false的元素被删除并结束扫描，
+    // hand停在下一个槽位。keep放过元素时通常会清掉它的访问标记，所以最多扫两圈就能删掉一个；
+    // 扫完两圈仍没有可删的元素（或表为空）时返回false
+    template <typename F>
+    bool SweepErase(std::size_t& hand, F&& keep) {
+        std::size_t capacity = Capacity();
+        for (std::size_t n = 0; n < capacity * 2; ++n) {
+            std::size_t index = hand++ % capacity;
+            hand %= capacity;
+            if (ctrlAt(index) < 0) {
+                continue;
+            }
+            auto& slot = _slots[index];
+            if (!keep(static_cast<const Key&>(slot.key), slot.value)) {
+                eraseAt(index);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 遍历所有元素，回调签名 void(const Key&, Value&)
+    template <typename F>
+    void ForEach(F&& visit) {
+        for (std::size_t g = 0; g < _groups; ++g) {
+            for (std::size_t i = 0; i < kGroupWidth; ++i) {
+                if (_ctrl[g].bytes[i] >= 0) {
+                    auto& slot = _slots[g * kGroupWidth + i];
+                    visit(static_cast<const Key&>(slot.key), slot.value);
+                }
+            }
+        }
+    }
+
+    // 预留至少能容纳count个元素的空间
+    void Reserve(std::size_t count) {
+        std::size_t groups = 1;
+        while (groups * kGroupWidth * kMaxLoadNum / kMaxLoadDen < count) {
+            groups <<= 1;
+        }
+        if (groups > _groups) {
+            resize(groups);
+        }
+    }
+
+    // 按当前元素数重建为能容纳它们的最小容量
+    void ShrinkToFit() {
+        if (_size == 0) {
+            Clear();
+            return;
+        }
+        std::size_t groups = 1;
+        while (groups * kGroupWidth * kMaxLoadNum / kMaxLoadDen < _size) {
+            groups <<= 1;
+        }
+        if (groups < _groups) {
+            resize(groups);
+        }
+    }
+
+    std::size_t Size() const { return _size; }
+    bool Empty() const { return _size == 0; }
+    std::size_t Capacity() const { return _groups * kGroupWidth; }
+    // 槽位数组和控制字节占用的内存
+    std::size_t MemoryUsage() const { return _groups * groupBytes(); }
+    // 内存不超过bytes时最多应保存的元素个数，超过后由调用者淘汰旧元素
+    // 只用到容量的3/4，剩下的空间留给删除标记，清理标记时原地重建而不会扩容
+    // extraPerElement为每个元素在表外另占的字节数（如定时项），一并计入bytes
+    static std::size_t MaxSizeForMemory(std::size_t bytes, std::size_t extraPerElement = 0) {
+        auto cost = [extraPerElement](std::size_t groups) {
+            return groups * groupBytes() + groups * kGroupWidth * 3 / 4 * extraPerElement;
+        };
+        std::size_t groups = 1;
+        while (cost(groups * 2) <= bytes) {
+            groups <<= 1;
+        }
+        return groups * kGroupWidth * 3 / 4;
+    }
+
+    // 表的原始内容，用于写快照：控制字节数组和槽位数组可以直接按字节保存，
+    // 读回时只要哈希函数和键值类型不变，就能原样恢复而不必逐个重新插入
+    struct RawView {
+        std::size_t groups;
+        std::size_t size;
+        std::size_t growth_left;
+        const void* ctrl;  // groups * 16 字节
+        const void* slots; // groups * 16 * SlotSize() 字节
+    };
+    RawView Raw() const { return RawView{ _groups, _size, _growth_left, _ctrl.get(), _slots.get() }; }
+    static constexpr std::size_t SlotSize() { return sizeof(Slot); }
+    static constexpr std::size_t GroupWidth() { return kGroupWidth; }
+
+    // 用快照中的原始内容替换当前表，groups不是2的幂或计数不合理时返回false且不修改表
+    bool Restore(const RawView& raw) {
+        if (raw.groups == 0 || (raw.groups & (raw.groups - 1)) != 0
+            || raw.size + raw.growth_left > raw.groups * kGroupWidth) {
+            return false;
+        }
+        std::unique_ptr<CtrlGroup[]> ctrl(new CtrlGroup[raw.groups]);
+        std::memcpy(ctrl.get(), raw.ctrl, raw.groups * sizeof(CtrlGroup));
+        // 控制字节里的元素数必须和记录的一致，否则说明文件已损坏
+        std::size_t full = 0;
+        for (std::size_t g = 0; g < raw.groups; ++g) {
+            for (std::size_t i = 0; i < kGroupWidth; ++i) {
+                full += ctrl[g].bytes[i] >= 0;
+            }
+        }
+        if (full != raw.size) {
+            return false;
+        }
+        std::unique_ptr<Slot[]> slots(new Slot[raw.groups * kGroupWidth]);
+        std::memcpy(static_cast<void*>(slots.get()), raw.slots, raw.groups * kGroupWidth * sizeof(Slot));
+        _ctrl.swap(ctrl);
+        _slots.swap(slots);
+        _groups = raw.groups;
+        _size = raw.size;
+        _growth_left = raw.growth_left;
+        return true;
+    }
+
+    void Clear() {
+        _ctrl.reset();
+        _slots.reset();
+        _groups = 0;
+        _size = 0;
+        _growth_left = 0;
+    }
+
+private:
+    static constexpr std::size_t kGroupWidth = 16;
+    static constexpr std::size_t kNotFound = static_cast<std::size_t>(-1);
+    // 最大装载率 7/8
+    static constexpr std::size_t kMaxLoadNum = 7;
+    static constexpr std::size_t kMaxLoadDen = 8;
+    static constexpr int8_t kEmpty = -128;
+    static constexpr int8_t kDeleted = -2;
+
+    struct Slot {
+        Key key;
+        Value value;
+    };
+
+    struct alignas(16) CtrlGroup {
+        int8_t bytes[kGroupWidth];
+    };
+
+    // 一组控制字节的并行比较，返回的位图第i位对应组内第i个槽
+    class Group
+    {
+    public:
+#ifdef FLAT_HASH_MAP_SSE2
+        explicit Group(const int8_t* ctrl) : _ctrl(_mm_load_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+        uint32_t Match(int8_t h) const {
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h), _ctrl)));
+        }
+        // 空和已删除的控制字节最高位都是1
+        uint32_t MatchEmptyOrDeleted() const {
+            return static_cast<uint32_t>(_mm_movemask_epi8(_ctrl));
+        }
+    private:
+        __m128i _ctrl;
+#else
+        explicit Group(const int8_t* ctrl) { std::memcpy(_ctrl, ctrl, kGroupWidth); }
+        uint32_t Match(int8_t h) const {
+            uint32_t mask = 0;
+            for (std::size_t i = 0; i < kGroupWidth; ++i) {
+                mask |= static_cast<uint32_t>(_ctrl[i] == h) << i;
+            }
+            return mask;
+        }
+        uint32_t MatchEmptyOrDeleted() const {
+            uint32_t mask = 0;
+            for (std::size_t i = 0; i < kGroupWidth; ++i) {
+                mask |= static_cast<uint32_t>(_ctrl[i] < 0) << i;
+            }
+            return mask;
+        }
+    private:
+        int8_t _ctrl[kGroupWidth];
+#endif
+    public:
+        uint32_t MatchEmpty() const { return Match(kEmpty); }
+    };
+
+    static std::size_t groupBytes() { return sizeof(CtrlGroup) + kGroupWidth * sizeof(Slot); }
+
+    static unsigned lowestBit(uint32_t mask) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return static_cast<unsigned>(index);
+#else
+        return static_cast<unsigned>(__builtin_ctz(mask));
+#endif
+    }
+
+    static std::size_t h1(uint64_t hash) { return static_cast<std::size_t>(hash >> 7); }
+    static int8_t h2(uint64_t hash) { return static_cast<int8_t>(hash & 0x7F); }
+
+    int8_t ctrlAt(std::size_t index) const { return _ctrl[index / kGroupWidth].bytes[index % kGroupWidth]; }
+    void setCtrl(std::size_t index, int8_t value) { _ctrl[index / kGroupWidth].bytes[index % kGroupWidth] = value; }
+
+    void eraseAt(std::size_t index) {
+        // 所在组还有空槽时，查找不会越过这一组，可以直接置空；否则留下删除标记
+        if (Group(_ctrl[index / kGroupWidth].bytes).MatchEmpty() != 0) {
+            setCtrl(index, kEmpty);
+            ++_growth_left;
+        }
+        else {
+            setCtrl(index, kDeleted);
+        }
+        --_size;
+    }
+
+    // 组间按三角数步长探测，组数为2的幂时能遍历所有组
+    std::size_t findIndex(const Key& key) const {
+        if (_groups == 0) {
+            return kNotFound;
+        }
+        uint64_t hash = Hash()(key);
+        std::size_t mask = _groups - 1;
+        std::size_t g = h1(hash) & mask;
+        for (std::size_t step = 1; ; ++step) {
+            Group group(_ctrl[g].bytes);
+            for (uint32_t match = group.Match(h2(hash)); match != 0; match &= match - 1) {
+                std::size_t index = g * kGroupWidth + lowestBit(match);
+                if (_slots[index].key == key) {
+                    return index;
+                }
+            }
+            // 组内有空槽说明键从未被放到更后面的组
+            if (group.MatchEmpty() != 0 || step > _groups) {
+                return kNotFound;
+            }
+            g = (g + step) & mask;
+        }
+    }
+
+    std::size_t findInsertSlot(uint64_t hash) const {
+        std::size_t mask = _groups - 1;
+        std::size_t g = h1(hash) & mask;
+        for (std::size_t step = 1; ; ++step) {
+            uint32_t match = Group(_ctrl[g].bytes).MatchEmptyOrDeleted();
+            if (match != 0) {
+                return g * kGroupWidth + lowestBit(match);
+            }
+            g = (g + step) & mask;
+        }
+    }
+
+    // 增长额度用完时：实际元素不超过容量的25/32（其余是删除标记）就原大小重建清掉标记，
+    // 否则容量翻倍
+    void rehash() {
+        if (_groups == 0) {
+            resize(1);
+        }
+        else if (_size * 32 <= Capacity() * 25) {
+            resize(_groups);
+        }
+        else {
+            resize(_groups * 2);
+        }
+    }
+
+    void resize(std::size_t groups) {
+        std::unique_ptr<CtrlGroup[]> oldCtrl(new CtrlGroup[groups]);
+        std::unique_ptr<Slot[]> oldSlots(new Slot[groups * kGroupWidth]);
+        std::memset(oldCtrl.get(), kEmpty, groups * sizeof(CtrlGroup));
+        oldCtrl.swap(_ctrl);
+        oldSlots.swap(_slots);
+        std::size_t oldGroups = _groups;
+        _groups = groups;
+        _growth_left = Capacity() * kMaxLoadNum / kMaxLoadDen - _size;
+
+        for (std::size_t g = 0; g < oldGroups; ++g) {
+            for (std::size_t i = 0; i < kGroupWidth; ++i) {
+                if (oldCtrl[g].bytes[i] < 0) {
+                    continue;
+                }
+                const auto& slot = oldSlots[g * kGroupWidth + i];
+                uint64_t hash = Hash()(slot.key);
+                std::size_t index = findInsertSlot(hash);
+                setCtrl(index, h2(hash));
+                _slots[index] = slot;
+            }
+        }
+    }
+
+    std::unique_ptr<CtrlGroup[]> _ctrl;
+    std::unique_ptr<Slot[]> _slots;
+    std::size_t _groups;
+    std::size_t _size;
+    std::size_t _growth_left; // 还能占用多少个空槽才需要扩容
+};
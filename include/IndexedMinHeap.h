@@ -0,0 +1,118 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// 带索引的二叉最小堆
+// 元素用稠密的整数id标识，堆里记录每个id当前所在的位置，
+// 所以可以按id在O(log n)内修改键值（增大或减小）或删除，堆顶读取是O(1)。
+// 本身不加锁，由使用者保证互斥。
+class IndexedMinHeap
+{
+public:
+    void Push(std::size_t id, int64_t key) {
+        if (id >= _pos.size()) {
+            _pos.resize(id + 1, kNotInHeap);
+        }
+        _pos[id] = _heap.size();
+        _heap.push_back(Node{ key, id });
+        siftUp(_heap.size() - 1);
+    }
+
+    // 修改键值，键变小向上调整，变大向下调整
+    void Update(std::size_t id, int64_t key) {
+        std::size_t pos = _pos[id];
+        int64_t old = _heap[pos].key;
+        _heap[pos].key = key;
+        if (key < old) {
+            siftUp(pos);
+        }
+        else if (key > old) {
+            siftDown(pos);
+        }
+    }
+
+    void Erase(std::size_t id) {
+        std::size_t pos = _pos[id];
+        std::size_t last = _heap.size() - 1;
+        if (pos != last) {
+            swapNodes(pos, last);
+        }
+        _heap.pop_back();
+        _pos[id] = kNotInHeap;
+        if (pos < _heap.size()) {
+            siftDown(pos);
+            siftUp(pos);
+        }
+    }
+
+    bool Contains(std::size_t id) const {
+        return id < _pos.size() && _pos[id] != kNotInHeap;
+    }
+
+    // 堆顶元素的id，调用前需保证堆非空
+    std::size_t Top() const { return _heap.front().id; }
+    int64_t TopKey() const { return _heap.front().key; }
+    bool Empty() const { return _heap.empty(); }
+    std::size_t Size() const { return _heap.size(); }
+
+    void Clear() {
+        _heap.clear();
+        _pos.clear();
+    }
+
+private:
+    static constexpr std::size_t kNotInHeap = std::numeric_limits<std::size_t>::max();
+
+    struct Node {
+        int64_t key;
+        std::size_t id;
+    };
+
+    // 键相同时按id比较，保证结果确定
+    static bool less(const Node& a, const Node& b) {
+        return a.key < b.key || (a.key == b.key && a.id < b.id);
+    }
+
+    void swapNodes(std::size_t a, std::size_t b) {
+        std::swap(_heap[a], _heap[b]);
+        _pos[_heap[a].id] = a;
+        _pos[_heap[b].id] = b;
+    }
+
+    void siftUp(std::size_t pos) {
+        while (pos > 0) {
+            std::size_t parent = (pos - 1) / 2;
+            if (!less(_heap[pos], _heap[parent])) {
+                break;
+            }
+            swapNodes(pos, parent);
+            pos = parent;
+        }
+    }
+
+    void siftDown(std::size_t pos) {
+        std::size_t n = _heap.size();
+        while (true) {
+            std::size_t smallest = pos;
+            std::size_t left = pos * 2 + 1;
+            std::size_t right = left + 1;
+            if (left < n && less(_heap[left], _heap[smallest])) {
+                smallest = left;
+            }
+            if (right < n && less(_heap[right], _heap[smallest])) {
+                smallest = right;
+            }
+            if (smallest == pos) {
+                break;
+            }
+            swapNodes(pos, smallest);
+            pos = smallest;
+        }
+    }
+
+    std::vector<Node> _heap;
+    std::vector<std::size_t> _pos; // id -> 在_heap中的位置
+};
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "ChatServerRegistry.h"
+#include "TimingWheel.h"
+
+// 分配预留表
+// GetChatServer分配服务器时先记一笔带期限的预留，连接数立即加一；
+// 聊天服务器转发的Login校验通过后预留转为正式连接，到期仍未确认则把连接数减回去。
+// 到期由时间轮驱动，每个预留的到期处理是O(1)，不需要扫描整张表。
+class LeaseTable
+{
+public:
+    // ttlTicks为预留期限（以Tick次数计），至少为1
+    LeaseTable(ChatServerRegistry& registry, uint64_t ttlTicks);
+    LeaseTable(const LeaseTable&) = delete;
+    LeaseTable& operator=(const LeaseTable&) = delete;
+
+    // 为uid预留server上的一个连接，返回预留前的连接数；该uid已有未确认的预留时先释放旧的
+    int Grant(int uid, const std::shared_ptr<ChatServer>& server);
+    // 批量预留，uids与servers一一对应，servers中为nullptr的跳过
+    // 连接数已由ChatServerRegistry::AssignBatch计入，这里只登记预留，整批加一次锁
+    void GrantBatch(const std::vector<int>& uids, const std::vector<std::shared_ptr<ChatServer>>& servers);
+    // 确认uid的预留，返回false表示没有预留（已过期或从未分配）
+    bool Confirm(int uid);
+    // 时间轮前进一跳，释放到期的预留
+    void Tick();
+    // 当前未确认的预留数
+    std::size_t Size() const;
+    void Clear();
+
+private:
+    struct Lease {
+        std::shared_ptr<ChatServer> server;
+        uint64_t generation;
+    };
+
+    struct Expiry {
+        int uid;
+        uint64_t generation;
+    };
+
+    // 归还预留占用的连接数，不持有_mutex时调用，避免和注册表的堆锁嵌套
+    void release(const std::shared_ptr<ChatServer>& server);
+
+    ChatServerRegistry& _registry;
+    uint64_t _ttl_ticks;
+    mutable std::mutex _mutex;
+    std::unordered_map<int, Lease> _leases;
+    TimingWheel<Expiry> _wheel;
+    uint64_t _next_generation;
+};
@@ -0,0 +1,164 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include "AsyncLogger.h"
+#include "CoarseClock.h"
+
+// 预注册格式串的日志
+// 每个LOGF_*调用点的格式串在静态初始化阶段登记到LogFormatRegistry，得到一个编号。
+// 热路径只把编号和参数的原始字节写进环形缓冲，不做任何文本格式化：
+// 文本模式下由后台线程按格式串展开，二进制模式（[Log] Format = binary）下原样写入日志文件，
+// 再用statuslog-decode离线还原。格式串中的{}依次被参数替换。
+
+// 一个调用点的格式信息，登记后不再改变
+struct LogFormatEntry {
+    uint32_t id;
+    LogLevel level;
+    uint32_t line;
+    std::string file;
+    std::string format;
+};
+
+// 格式串登记表，编号从1开始，0表示普通文本日志
+class LogFormatRegistry
+{
+public:
+    static uint32_t Register(LogLevel level, const char* file, uint32_t line, const char* format);
+    // 编号对应的格式，不存在时返回nullptr；登记后的条目地址不变，可以一直持有
+    static const LogFormatEntry* Find(uint32_t id);
+    static uint32_t Size();
+};
+
+// 参数的二进制编码：1字节类型 + 数据
+// 'i' int64，'u' uint64，'d' double，'c' char，'s' uint16长度 + 字节
+class LogArgEncoder
+{
+public:
+    explicit LogArgEncoder(LogRecord& record) : _record(record) {}
+
+    void Put(const char* text) { putString(text, std::strlen(text)); }
+    void Put(const std::string& text) { putString(text.data(), text.size()); }
+    void Put(char c) { putRaw('c', &c, 1); }
+    void Put(double value) { putRaw('d', &value, sizeof(value)); }
+    void Put(float value) { Put(static_cast<double>(value)); }
+    template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+    void Put(T value) {
+        if (std::is_signed<T>::value) {
+            int64_t v = static_cast<int64_t>(value);
+            putRaw('i', &v, sizeof(v));
+        }
+        else {
+            uint64_t v = static_cast<uint64_t>(value);
+            putRaw('u', &v, sizeof(v));
+        }
+    }
+    template <typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+    void Put(T value) { Put(static_cast<typename std::underlying_type<T>::type>(value)); }
+
+private:
+    // 放不下时标记截断，之后的参数都丢弃
+    bool fits(std::size_t size) {
+        if (_record.truncated || _record.length + size > LogRecord::kTextSize) {
+            _record.truncated = true;
+            return false;
+        }
+        return true;
+    }
+    void putRaw(char type, const void* data, std::size_t size) {
+        if (!fits(1 + size)) {
+            return;
+        }
+        char* out = _record.text + _record.length;
+        out[0] = type;
+        std::memcpy(out + 1, data, size);
+        _record.length = static_cast<uint16_t>(_record.length + 1 + size);
+    }
+    void putString(const char* text, std::size_t size) {
+        // 长字符串截短到剩余空间，保证后面至少还能看到它的开头
+        if (!fits(1 + sizeof(uint16_t))) {
+            return;
+        }
+        std::size_t room = LogRecord::kTextSize - _record.length - 1 - sizeof(uint16_t);
+        if (size > room) {
+            size = room;
+        }
+        uint16_t length = static_cast<uint16_t>(size);
+        char* out = _record.text + _record.length;
+        out[0] = 's';
+        std::memcpy(out + 1, &length, sizeof(length));
+        std::memcpy(out + 1 + sizeof(length), text, size);
+        _record.length = static_cast<uint16_t>(_record.length + 1 + sizeof(length) + size);
+    }
+
+    LogRecord& _record;
+};
+
+// 按格式串展开编码后的参数，追加到out；日志后台线程和statuslog-decode共用
+void RenderLogFormat(const std::string& format, const char* args, std::size_t length, std::string& out);
+
+// 每个调用点一个Tag类型，LogSite<Tag>::id在静态初始化时完成登记
+template <typename Tag>
+struct LogSite {
+    static const uint32_t id;
+};
+
+template <typename Tag>
+const uint32_t LogSite<Tag>::id = LogFormatRegistry::Register(Tag::Level(), Tag::File(), Tag::Line(), Tag::Format());
+
+template <typename Tag, typename... Args>
+void WriteLogFormat(const char* /*format*/, const Args&... args)
+{
+    LogRecord* record;
+    LogRecord direct;
+    LogRing* ring = AsyncLogger::ThreadRing();
+    if (ring) {
+        record = ring->Reserve();
+        if (!record) {
+            return;
+        }
+    }
+    else {
+        record = &direct;
+    }
+    record->time_ms = CoarseClock::NowMs();
+    record->format_id = LogSite<Tag>::id;
+    record->length = 0;
+    record->level = Tag::Level();
+    record->truncated = false;
+    LogArgEncoder encoder(*record);
+    int expand[] = { 0, (encoder.Put(args), 0)... };
+    (void)expand;
+    if (ring) {
+        ring->Commit();
+    }
+    else {
+        AsyncLogger::WriteDirect(direct);
+    }
+}
+
+// 取第一个宏参数（格式串），多包一层展开以兼容MSVC传统预处理器对__VA_ARGS__的处理
+#define STATUS_LOG_EXPAND(x) x
+#define STATUS_LOG_FIRST_(first, ...) first
+#define STATUS_LOG_FIRST(...) STATUS_LOG_EXPAND(STATUS_LOG_FIRST_(__VA_ARGS__, unused))
+
+// 用法：LOGF_DEBUG("收到登录请求，用户ID: {}", uid);
+// 第一个参数必须是字符串字面量，级别判断与LOG_*相同，被跳过时参数不会求值
+#define STATUS_LOGF(level, ...) \
+    do { \
+        if (LogCompiledIn(level) && AsyncLogger::Enabled(level)) { \
+            struct LogSiteTag { \
+                static LogLevel Level() { return level; } \
+                static const char* File() { return __FILE__; } \
+                static uint32_t Line() { return __LINE__; } \
+                static const char* Format() { return STATUS_LOG_FIRST(__VA_ARGS__); } \
+            }; \
+            WriteLogFormat<LogSiteTag>(__VA_ARGS__); \
+        } \
+    } while (0)
+#define LOGF_DEBUG(...) STATUS_LOGF(LogLevel::Debug, __VA_ARGS__)
+#define LOGF_INFO(...) STATUS_LOGF(LogLevel::Info, __VA_ARGS__)
+#define LOGF_WARN(...) STATUS_LOGF(LogLevel::Warn, __VA_ARGS__)
+#define LOGF_ERROR(...) STATUS_LOGF(LogLevel::Error, __VA_ARGS__)
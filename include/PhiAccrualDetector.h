@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Phi累积故障检测器
+// 记录最近若干次心跳的到达间隔，假设间隔服从正态分布，
+// phi = -log10(1 - F(距上次心跳的时间))，phi越大说明服务器越可能已经宕机。
+// 与固定超时相比，能自动适应不同服务器的心跳节奏和网络抖动。
+// 心跳非常规律时标准差接近0，一次GC停顿或网络抖动就会让phi暴涨，因此：
+// minStdDevMs给标准差设下限，acceptablePauseMs是额外容忍的停顿，计算时加到平均间隔上。
+class PhiAccrualDetector
+{
+public:
+    explicit PhiAccrualDetector(std::size_t windowSize = 100, double minStdDevMs = 100.0, double acceptablePauseMs = 0.0);
+    PhiAccrualDetector(const PhiAccrualDetector&) = delete;
+    PhiAccrualDetector& operator=(const PhiAccrualDetector&) = delete;
+
+    // 记录一次心跳
+    void Heartbeat(int64_t nowMs);
+    // 计算当前的phi值；心跳样本不足时返回0，即从不上报心跳的服务器不会被判定为故障
+    double Phi(int64_t nowMs) const;
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<double> _intervals; // 环形缓冲，保存最近windowSize个间隔
+    std::size_t _window_size;
+    std::size_t _next;
+    double _sum;
+    double _sum_sq;
+    double _min_std_dev;
+    double _acceptable_pause;
+    int64_t _last_ms; // 上次心跳时间，-1表示尚未收到心跳
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include <atomic>
 #include <queue>
+#include <vector>
+#include <utility>
 #include "Singleton.h"
 #include "hiredis/hiredis.h"
 #include "ConfigMgr.h"
@@ -11,6 +13,8 @@ public:
     ~RedisConPool();
     redisContext* getConnection();
     void returnConnection(redisContext* context);
+    // 连接已断开或回复已错位（如流水线读到一半失败）时调用：关闭它并补充一条新连接
+    void discardConnection(redisContext* context);
     void Close();
 
 private:
@@ -34,6 +38,10 @@ public:
     ~RedisMgr();
     bool Get(const std::string& key, std::string& value);
     bool Set(const std::string& key, const std::string& value);
+    // 用一条连接流水线批量执行SET，ttlSeconds大于0时附带EX过期时间
+    // failed非空时追加写入失败的条目下标，便于调用者只重试这些条目
+    bool SetBatch(const std::vector<std::pair<std::string, std::string>>& kvs, int ttlSeconds,
+        std::vector<std::size_t>* failed = nullptr);
     bool Auth(const std::string& password);
     bool LPush(const std::string& key, const std::string& value);
     bool LPop(const std::string& key, std::string& value);
@@ -0,0 +1,57 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TokenStore.h"
+
+// 基于RedisMgr的共享令牌存储
+// RPC线程只把令牌追加到内存写缓冲里就返回，后台线程每隔flushInterval把缓冲中的写入
+// 合并成一批，通过流水线一次性写入Redis（SET utoken_<uid> <token> EX ttl）。
+// 内存里保存二进制令牌，写入Redis时才转成文本，Redis中的格式与其他服务保持一致。
+// 多个StatusServer实例连同一个Redis即可互相校验对方签发的令牌。
+// 写入失败的令牌放回写缓冲，下一批重试（期间仍可在本实例校验），重试kMaxAttempts次后丢弃并记录错误。
+class RedisTokenStore : public TokenStore
+{
+public:
+    RedisTokenStore(uint32_t ttlSeconds, std::chrono::microseconds flushInterval);
+    ~RedisTokenStore();
+    RedisTokenStore(const RedisTokenStore&) = delete;
+    RedisTokenStore& operator=(const RedisTokenStore&) = delete;
+
+    bool Insert(int uid, const TokenBytes& token) override;
+    // 整批追加到写缓冲，只加一次锁
+    void InsertBatch(const std::vector<std::pair<int, TokenBytes>>& tokens) override;
+    int Verify(int uid, const TokenBytes& token) override;
+    // 尚未写入Redis的令牌数
+    std::size_t Size() const override;
+    // Redis中的数据由所有实例共享，这里只把写缓冲刷出去，不删除Redis里的令牌
+    void Clear() override;
+
+private:
+    struct PendingToken {
+        int uid;
+        TokenBytes token;
+        uint32_t attempts;  // 已经写入失败的次数
+    };
+
+    void flushLoop();
+    // 写入一批令牌，写入失败的条目追加到failed
+    void flush(const std::vector<PendingToken>& batch, std::vector<PendingToken>& failed);
+    // 把失败的条目放回写缓冲的最前面，调用时须持有_mutex
+    void requeueLocked(std::vector<PendingToken>& failed);
+    // 在写缓冲和正在写入的批次里查找，保证刚签发的令牌立即可校验
+    bool findPending(int uid, TokenBytes& token) const;
+
+    uint32_t _ttl_seconds;
+    std::chrono::microseconds _flush_interval;
+    std::vector<PendingToken> _pending;   // 等待写入的令牌
+    std::vector<PendingToken> _inflight;  // 正在写入Redis的批次
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _b_stop;
+    std::thread _flush_thread;
+};
@@ -0,0 +1,49 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <grpcpp/grpcpp.h>
+#include "message.grpc.pb.h"
+#include "ChatServerRegistry.h"
+#include "TokenStore.h"
+
+// 备机端：订阅主机的Replicate流，把收到的服务器和令牌应用到本地
+// 断线后每隔一秒重连，重连后主机会重新发一次全量。
+// 主机故障时直接把GateServer和聊天服务器指向备机即可，备机上已经有全部服务器和令牌。
+class ReplicationClient
+{
+public:
+    // primary为主机地址（host:port），name是本备机在主机日志中显示的名字
+    // secret为主机配置的ReplicationSecret；tokens为空表示不复制令牌
+    ReplicationClient(ChatServerRegistry& servers, TokenStore* tokens,
+        const std::string& primary, const std::string& name, const std::string& secret);
+    ~ReplicationClient();
+    ReplicationClient(const ReplicationClient&) = delete;
+    ReplicationClient& operator=(const ReplicationClient&) = delete;
+
+    // 取消当前的流并等待复制线程退出
+    void Stop();
+    // 最近应用的批次序号，全量批次不计
+    uint64_t LastSequence() const { return _last_sequence.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    void apply(const message::ReplicationBatch& batch);
+
+    ChatServerRegistry& _servers;
+    TokenStore* _tokens;
+    std::string _primary;
+    std::string _name;
+    std::string _secret;
+    std::atomic<uint64_t> _last_sequence;
+
+    std::mutex _mutex; // 保护_context和_b_stop
+    std::condition_variable _stop_cond; // 重连等待期间可被Stop打断
+    grpc::ClientContext* _context;
+    bool _b_stop;
+    std::thread _thread;
+};
@@ -0,0 +1,88 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include "message.grpc.pb.h"
+#include "ChatServerRegistry.h"
+#include "TokenStore.h"
+
+// 主机端的复制出口
+// 备机通过Replicate服务端流订阅，先收到一次全量（reset批次：全部服务器和令牌），之后是增量。
+// RPC线程只把新令牌追加到缓冲里；后台线程每隔flushInterval把缓冲中的令牌和
+// 与上次相比有变化的服务器（地址、权重、连接数，或已下线）合成一个批次，推给所有备机。
+// 服务器记录携带的是连接数的绝对值，重复应用不会出错，全量和增量之间不需要精确衔接。
+// 全量里有全部有效令牌，备机必须带上相同的共享密钥，配置了白名单时对端地址还必须在白名单内。
+class ReplicationHub
+{
+public:
+    // tokens为空表示不复制令牌（Redis和签名模式下令牌不在本进程里）
+    // queueLimit为每个备机最多积压的批次数，超过说明备机跟不上，断开它的流让它重新全量同步
+    // secret为备机须出示的共享密钥，不能为空；allowedPeers为允许订阅的备机IP，为空时不限制地址
+    ReplicationHub(ChatServerRegistry& servers, TokenStore* tokens,
+        std::chrono::milliseconds flushInterval, std::size_t queueLimit,
+        const std::string& secret, const std::vector<std::string>& allowedPeers);
+    ~ReplicationHub();
+    ReplicationHub(const ReplicationHub&) = delete;
+    ReplicationHub& operator=(const ReplicationHub&) = delete;
+
+    // 记录令牌写入，没有备机连接时直接忽略
+    void RecordToken(int uid, const TokenBytes& token);
+    void RecordTokens(const std::vector<std::pair<int, TokenBytes>>& tokens);
+    // 处理一个备机的Replicate流，备机断开、跟不上或服务停止时返回
+    grpc::Status Serve(grpc::ServerContext* context, const message::ReplicateReq* request,
+        grpc::ServerWriter<message::ReplicationBatch>* writer);
+    // 停止刷新线程并让所有Serve返回，须在grpc::Server::Shutdown之前调用，否则Shutdown会一直等待复制流
+    void Stop();
+    std::size_t SubscriberCount() const;
+
+private:
+    struct Subscriber {
+        std::deque<std::shared_ptr<const message::ReplicationBatch>> queue;
+        bool broken = false;
+    };
+
+    // 备机上次收到的服务器状态，用来计算增量，只在刷新线程里访问
+    struct SentServer {
+        std::string host;
+        std::string port;
+        int weight;
+        int con_count;
+    };
+
+    // 校验密钥和对端地址
+    bool authorize(grpc::ServerContext* context, const message::ReplicateReq* request) const;
+    void flushLoop();
+    // 把有变化的服务器写入批次
+    void appendServerChanges(message::ReplicationBatch& batch);
+    bool sendFullSync(grpc::ServerWriter<message::ReplicationBatch>* writer);
+
+    ChatServerRegistry& _servers;
+    TokenStore* _tokens;
+    std::chrono::milliseconds _flush_interval;
+    std::size_t _queue_limit;
+    std::string _secret;
+    std::vector<std::string> _allowed_peers;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _flush_cond;      // 唤醒刷新线程
+    std::condition_variable _subscriber_cond; // 唤醒等待新批次的Serve
+    std::vector<std::pair<int, TokenBytes>> _pending;
+    std::vector<std::shared_ptr<Subscriber>> _subscribers;
+    std::atomic<bool> _has_subscribers;
+    uint64_t _sequence;
+    bool _b_stop;
+
+    std::unordered_map<std::string, SentServer> _sent;
+    std::thread _flush_thread;
+};
@@ -0,0 +1,92 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "FlatHashMap.h"
+#include "TimingWheel.h"
+#include "TokenStore.h"
+
+// 按uid哈希分片的令牌存储
+// 每个分片有自己的锁和扁平哈希表，登录高峰时不同uid的请求落在不同分片上，不再排队抢同一把锁
+// 配置了TTL时，每个分片再挂一个时间轮，由外部定时调用Tick驱动过期
+// 配置了内存预算时，按分片平分预算，分片满后用CLOCK算法淘汰最近没有被校验过的令牌；
+// 预算同时覆盖时间轮上的定时项：覆盖写入和淘汰留下的过时定时项超过有效令牌数时整轮清理一次，
+// 因此每个令牌最多对应两个定时项，按这个上限预留
+class ShardedTokenStore : public TokenStore
+{
+public:
+    // shardCount会向上取整到2的幂，方便用掩码取模
+    // ttlTicks为令牌有效期（以Tick次数计），为0表示永不过期
+    // memoryBudget为所有分片哈希表和时间轮合计的内存上限（字节），为0表示不限制
+    ShardedTokenStore(std::size_t shardCount, uint64_t ttlTicks = 0, std::size_t memoryBudget = 0);
+    ShardedTokenStore(const ShardedTokenStore&) = delete;
+    ShardedTokenStore& operator=(const ShardedTokenStore&) = delete;
+
+    // 写入令牌，返回true表示覆盖了该uid已有的令牌
+    bool Insert(int uid, const TokenBytes& token) override;
+    // 按分片归并后写入，每个涉及到的分片只加一次锁
+    void InsertBatch(const std::vector<std::pair<int, TokenBytes>>& tokens) override;
+    // 校验令牌，返回ErrorCodes：SUCCESS / UidInvalid / TokenInvalid（含已过期）
+    int Verify(int uid, const TokenBytes& token) override;
+    // 时间轮前进一跳，处理所有分片中到期的令牌
+    void Tick() override;
+    std::size_t Size() const override;
+    // 所有分片时间轮上仍对应当前令牌的定时项总数
+    std::size_t LiveTimers() const override;
+    // 逐个分片复制出未过期的令牌后再回调，回调期间不持有分片锁
+    void ForEachToken(const std::function<void(int uid, const TokenBytes& token)>& visit) const override;
+    // 命中、未命中、淘汰次数和内存占用
+    TokenStoreStats Stats() const override;
+    void Clear() override;
+    std::size_t ShardCount() const { return _mask + 1; }
+
+    // 把所有分片的哈希表和未到期的定时项写入快照文件，先写临时文件再改名，不会留下写了一半的快照
+    // 每个分片只在复制内存时持锁，写盘时不阻塞请求；tickMs用于在读回时换算经过的跳数
+    bool SaveSnapshot(const std::string& path, uint64_t tickMs) const override;
+    // 启动时用内存映射读取快照，哈希表按原始字节整块恢复，不逐条重放；
+    // 分片数或格式不一致、文件损坏时不加载。返回恢复的令牌数
+    std::size_t LoadSnapshot(const std::string& path, uint64_t tickMs) override;
+
+private:
+    // 代数只用来识别时间轮上过时的定时项，32位足够：同一分片在一个TTL内不会写入2^32次
+    struct TokenEntry {
+        TokenBytes token;
+        uint32_t generation;
+        bool expired; // 已过期但还保留一个周期，用于给Login返回TokenInvalid
+        bool referenced; // CLOCK访问标记，写入和校验命中时置位，时钟指针经过时清除
+    };
+
+    struct Expiry {
+        int uid;
+        uint32_t generation;
+    };
+
+    // 每个分片独占缓存行，避免相邻分片的锁互相伪共享
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        FlatHashMap<int, TokenEntry> tokens;
+        TimingWheel<Expiry> wheel;
+        uint32_t next_generation = 0;
+        std::size_t clock_hand = 0;
+        std::size_t stale_timers = 0; // 时间轮上已不对应当前令牌的定时项数
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+    Shard& shardFor(int uid) const;
+    // 分片已满且要写入新uid时淘汰一个令牌，调用者需持有分片锁
+    void makeRoom(Shard& shard, int uid);
+    // 用CLOCK算法淘汰一个令牌，调用者需持有分片锁
+    bool evictOne(Shard& shard);
+    void insertLocked(Shard& shard, int uid, const TokenBytes& token, bool& existed);
+    // 过时定时项过多时从时间轮上清掉，调用者需持有分片锁
+    void compactTimers(Shard& shard);
+
+    std::unique_ptr<Shard[]> _shards;
+    std::size_t _mask;
+    uint64_t _ttl_ticks;
+    std::size_t _max_per_shard; // 每个分片最多保存的令牌数，0表示不限制
+};
@@ -1,6 +1,9 @@
 #pragma once
 #include <unordered_map>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <memory>
 #include <string>
 #include <iostream>
 // gRPC 核心库
@@ -13,6 +16,14 @@
 
 #include "message.grpc.pb.h"
 #include "ConfigMgr.h"
+#include "ChatServerRegistry.h"
+#include "LeaseTable.h"
+#include "ShardedTokenStore.h"
+#include "RedisTokenStore.h"
+#include "ReplicationClient.h"
+#include "ReplicationHub.h"
+#include "TokenSigner.h"
+#include "VerifyStreamServer.h"
 #include "const.h"
 
 using grpc::Server;
@@ -23,29 +34,25 @@ using message::GetChatServerReq;
 using message::GetChatServerRsp;
 using message::LoginReq;
 using message::LoginRsp;
+using message::ReportLoadReq;
+using message::ReportLoadRsp;
+using message::RegisterChatServerReq;
+using message::RegisterChatServerRsp;
+using message::HeartbeatReq;
+using message::HeartbeatRsp;
+using message::DeregisterReq;
+using message::DeregisterRsp;
+using message::BatchGetChatServerReq;
+using message::BatchGetChatServerRsp;
+using message::ChatServerAssignment;
+using message::ReplicateReq;
+using message::ReplicationBatch;
+using message::SetLogLevelReq;
+using message::SetLogLevelRsp;
 using message::StatusService;
 
-struct ChatServer {
-    ChatServer() :host(""), port(""), name(""), con_count(0) {}
-    ChatServer(const ChatServer& cs) :host(cs.host), port(cs.port), name(cs.name), con_count(cs.con_count) {}
-    ChatServer& operator=(const ChatServer& cs) {
-        if (&cs == this) {
-            return *this;
-        }
-
-        host = cs.host;
-        name = cs.name;
-        port = cs.port;
-        con_count = cs.con_count;
-        return *this;
-    }
-    std::string host;
-    std::string port;
-    std::string name;
-    int con_count;
-};
-
-class StatusServiceImpl final : public StatusService::Service
+// VerifyTokens是异步双向流，由VerifyStreamServer在完成队列上处理，其余RPC为同步实现
+class StatusServiceImpl final : public VerifyStreamServer::AsyncService
 {
 public:
     StatusServiceImpl();
@@ -53,16 +60,63 @@ public:
 
     Status GetChatServer(ServerContext* context, const GetChatServerReq* request,
         GetChatServerRsp* reply) override;
+    // GateServer批量获取聊天服务器，整批只加一次注册表和令牌表的锁
+    Status BatchGetChatServer(ServerContext* context, const BatchGetChatServerReq* request,
+        BatchGetChatServerRsp* reply) override;
     Status Login(ServerContext* context, const LoginReq* request,
         LoginRsp* reply);
+    // 聊天服务器周期性上报的实际连接数，覆盖本地计数
+    Status ReportLoad(ServerContext* context, const ReportLoadReq* request,
+        ReportLoadRsp* reply) override;
+    // 聊天服务器运行期上线、心跳（携带连接数）和下线
+    Status RegisterChatServer(ServerContext* context, const RegisterChatServerReq* request,
+        RegisterChatServerRsp* reply) override;
+    Status Heartbeat(ServerContext* context, const HeartbeatReq* request,
+        HeartbeatRsp* reply) override;
+    Status Deregister(ServerContext* context, const DeregisterReq* request,
+        DeregisterRsp* reply) override;
+    // 备机订阅本机的服务器和令牌变化，流一直保持到备机断开或本机停止
+    Status Replicate(ServerContext* context, const ReplicateReq* request,
+        grpc::ServerWriter<ReplicationBatch>* writer) override;
+    // 运维接口：运行期切换日志级别，level为空时只返回当前级别
+    Status SetLogLevel(ServerContext* context, const SetLogLevelReq* request,
+        SetLogLevelRsp* reply) override;
+    // 结束所有复制流，须在grpc::Server::Shutdown之前调用
+    void StopReplication();
+    // 校验令牌并确认分配预留，返回ErrorCodes；Login和VerifyTokens流共用
+    int VerifyToken(int uid, const std::string& token);
+    // 令牌时间轮上的定时项数量，供健康检查输出
+    std::size_t TokenTimerCount() const;
+    // 令牌表的命中、淘汰和内存统计，签名模式下全为0
+    TokenStoreStats TokenStats() const;
 
 private:
-    void insertToken(int uid, const std::string& token);
-    ChatServer getChatServer();
-    void updateServerConnectionCount(const std::string& serverName, int delta);
+    void insertToken(int uid, const TokenBytes& token);
+    std::shared_ptr<ChatServer> getChatServer(int uid);
+    void scheduleTokenExpire();
+    void scheduleFailureCheck();
+    void scheduleLeaseExpire();
+    void snapshotLoop();
+
+    ChatServerRegistry _servers; // 快照式注册表，选择服务器时不加锁
+    std::unique_ptr<LeaseTable> _leases; // 已分配未登录的连接预留，LeaseMs为0时为空
+    std::unique_ptr<TokenStore> _tokens; // 令牌存储后端，由配置TokenMode决定，签名模式下为空
+    std::unique_ptr<TokenSigner> _signer; // 签名令牌模式下非空
+    std::unique_ptr<boost::asio::steady_timer> _expire_timer; // 驱动令牌时间轮的定时器
+    uint64_t _tick_ms = 1000;
+    std::unique_ptr<boost::asio::steady_timer> _detect_timer; // 周期检查聊天服务器心跳的定时器
+    uint64_t _detect_ms = 1000;
+    double _phi_threshold = 8.0;
+    std::unique_ptr<boost::asio::steady_timer> _lease_timer; // 驱动预留到期的定时器
+    uint64_t _lease_tick_ms = 100;
+    std::unique_ptr<ReplicationHub> _replication; // 向备机推送变化，配置了ReplicationSecret才开启
+    std::unique_ptr<ReplicationClient> _replica; // 配置了ReplicaOf时本机作为备机，从主机同步
 
-    std::unordered_map<std::string, ChatServer> _servers;
-    std::mutex _server_mutex;
-    std::unordered_map<int, std::string> _tokens;
-    std::mutex _token_mutex;
+    // 令牌快照：写盘耗时较长，放在独立线程里，不占用IO线程池
+    std::string _snapshot_path; // 为空表示不写快照
+    std::chrono::seconds _snapshot_interval{ 60 };
+    std::thread _snapshot_thread;
+    std::mutex _snapshot_mutex;
+    std::condition_variable _snapshot_cond;
+    bool _b_stop = false;
 };
\ No newline at end of file
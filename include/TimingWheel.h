@@ -0,0 +1,165 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// 分层时间轮（四层：256 + 64 + 64 + 64 个槽，最长约 2^26 跳）
+// 每一跳只处理当前槽里到期的元素，上层槽在下层转完一圈时整体下放，
+// 每个元素一生最多被搬运三次，所以单跳的摊还代价是 O(到期数)，不用全表扫描。
+// 本身不加锁，由使用者保证同一时间只有一个线程访问。
+template <typename T>
+class TimingWheel
+{
+public:
+    TimingWheel() : _now(0), _size(0) {}
+
+    // delay 以“跳”为单位，至少为 1，即最早在下一跳到期
+    void Add(uint64_t delay, T value) {
+        if (delay == 0) {
+            delay = 1;
+        }
+        if (delay >= kMaxDelay) {
+            delay = kMaxDelay - 1;
+        }
+        place(Node{ _now + delay, std::move(value) });
+        ++_size;
+    }
+
+    // 前进一跳，对每个到期元素调用 onExpire(T&)
+    // 回调里可以再次 Add，新元素不会在本跳内到期
+    template <typename F>
+    void Tick(F&& onExpire) {
+        ++_now;
+        if ((_now & kLevel0Mask) == 0) {
+            cascade();
+        }
+
+        std::vector<Node> expired;
+        expired.swap(_level0[_now & kLevel0Mask]);
+        _size -= expired.size();
+        for (auto& node : expired) {
+            onExpire(node.value);
+        }
+    }
+
+    // 遍历轮上所有元素，回调签名 void(uint64_t 剩余跳数, const T&)，用于导出快照
+    template <typename F>
+    void ForEach(F&& visit) const {
+        for (const auto& slot : _level0) {
+            for (const auto& node : slot) {
+                visit(node.expires - _now, node.value);
+            }
+        }
+        for (const auto& level : _levels) {
+            for (const auto& slot : level) {
+                for (const auto& node : slot) {
+                    visit(node.expires - _now, node.value);
+                }
+            }
+        }
+    }
+
+    // 删除满足条件的元素，回调签名 bool(const T&)，返回删除的个数
+    // 用于清理已经失效的元素，代价是一次全轮扫描
+    template <typename F>
+    std::size_t RemoveIf(F&& pred) {
+        std::size_t removed = 0;
+        auto sweep = [&pred, &removed](std::vector<Node>& slot) {
+            auto end = std::remove_if(slot.begin(), slot.end(), [&pred](const Node& node) { return pred(node.value); });
+            removed += static_cast<std::size_t>(slot.end() - end);
+            slot.erase(end, slot.end());
+            // 删掉大部分元素后把多余的容量还回去，否则内存占用不会下降
+            if (slot.size() < slot.capacity() / 4) {
+                slot.shrink_to_fit();
+            }
+        };
+        for (auto& slot : _level0) {
+            sweep(slot);
+        }
+        for (auto& level : _levels) {
+            for (auto& slot : level) {
+                sweep(slot);
+            }
+        }
+        _size -= removed;
+        return removed;
+    }
+
+    // 当前挂在轮上的元素个数
+    std::size_t Size() const { return _size; }
+    uint64_t Now() const { return _now; }
+    // 各槽已分配的内存（按容量计）
+    std::size_t MemoryUsage() const {
+        std::size_t capacity = 0;
+        for (const auto& slot : _level0) {
+            capacity += slot.capacity();
+        }
+        for (const auto& level : _levels) {
+            for (const auto& slot : level) {
+                capacity += slot.capacity();
+            }
+        }
+        return capacity * sizeof(Node);
+    }
+    // 每个元素占用的字节数，用于估算内存预算
+    static constexpr std::size_t NodeBytes() { return sizeof(Node); }
+
+private:
+    static constexpr unsigned kLevel0Bits = 8;
+    static constexpr unsigned kLevelNBits = 6;
+    static constexpr uint64_t kLevel0Size = 1ull << kLevel0Bits;
+    static constexpr uint64_t kLevelNSize = 1ull << kLevelNBits;
+    static constexpr uint64_t kLevel0Mask = kLevel0Size - 1;
+    static constexpr uint64_t kLevelNMask = kLevelNSize - 1;
+    static constexpr std::size_t kUpperLevels = 3;
+    static constexpr uint64_t kMaxDelay = 1ull << (kLevel0Bits + kUpperLevels * kLevelNBits);
+
+    struct Node {
+        uint64_t expires;
+        T value;
+    };
+
+    static unsigned shiftOf(std::size_t level) {
+        return kLevel0Bits + static_cast<unsigned>(level) * kLevelNBits;
+    }
+
+    // 根据剩余跳数决定放在哪一层
+    void place(Node&& node) {
+        uint64_t delta = node.expires - _now;
+        if (delta < kLevel0Size) {
+            _level0[node.expires & kLevel0Mask].push_back(std::move(node));
+            return;
+        }
+        for (std::size_t level = 0; level < kUpperLevels; ++level) {
+            if (delta < (1ull << shiftOf(level + 1)) || level + 1 == kUpperLevels) {
+                auto index = (node.expires >> shiftOf(level)) & kLevelNMask;
+                _levels[level][index].push_back(std::move(node));
+                return;
+            }
+        }
+    }
+
+    // 低层转完一圈，把上层对应槽的元素重新分配到更低的层；
+    // 上层也恰好转完一圈时继续向上层借
+    void cascade() {
+        for (std::size_t level = 0; level < kUpperLevels; ++level) {
+            auto index = (_now >> shiftOf(level)) & kLevelNMask;
+            std::vector<Node> bucket;
+            bucket.swap(_levels[level][index]);
+            for (auto& node : bucket) {
+                place(std::move(node));
+            }
+            if (index != 0) {
+                break;
+            }
+        }
+    }
+
+    uint64_t _now;
+    std::size_t _size;
+    std::array<std::vector<Node>, kLevel0Size> _level0;
+    std::array<std::array<std::vector<Node>, kLevelNSize>, kUpperLevels> _levels;
+};
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// 16字节二进制令牌，令牌表内部只保存这种形式，文本只出现在protobuf字段里
+struct TokenBytes {
+    uint8_t data[16];
+};
+
+// 登录令牌生成器
+// 随机数直接来自OpenSSL的RAND_bytes，每个线程一次取kBufferBytes字节缓存起来，
+// 摊薄每次调用的开销。生成时不加锁、不分配内存，
+// 文本形式按UUID v4的格式直接写进调用者提供的定长缓冲。
+class TokenGenerator
+{
+public:
+    static constexpr std::size_t kTokenBytes = sizeof(TokenBytes); // 令牌的二进制长度
+    static constexpr std::size_t kTextLength = 36; // 文本形式 xxxxxxxx-xxxx-4xxx-yxxx-xxxxxxxxxxxx，不含结尾'\0'
+
+    // 生成16字节随机令牌，已按UUID v4设置版本位和变体位
+    static void NextBytes(TokenBytes& out);
+    // 16字节令牌转文本，写入kTextLength个字符，不追加'\0'
+    static void Format(const TokenBytes& bytes, char (&out)[kTextLength]);
+    static std::string ToString(const TokenBytes& bytes);
+    // 文本转16字节令牌，长度或格式不对时返回false；只接受Format输出的小写十六进制
+    static bool Parse(const std::string& text, TokenBytes& out);
+    // 常量时间比较，耗时与两个令牌第几个字节开始不同无关
+    static bool Equal(const TokenBytes& a, const TokenBytes& b);
+
+    // 每个线程每次从RAND_bytes取的字节数，够256个令牌
+    static constexpr std::size_t kBufferBytes = 4096;
+};
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+// 无状态签名令牌
+// 令牌内容为 uid、过期时间（Unix秒）和聊天服务器名，后面附带HMAC-SHA256截断的16字节签名，
+// 整体用base64url编码。校验只需要重新计算一次HMAC，不查表、不加锁，
+// 任意持有相同密钥的StatusServer实例都能校验。
+class TokenSigner
+{
+public:
+    TokenSigner(const std::string& key, uint32_t ttlSeconds);
+
+    // 签发令牌
+    std::string Issue(int uid, const std::string& serverName) const;
+    // 校验令牌，返回ErrorCodes：SUCCESS / TokenInvalid（格式错误、签名不符、uid不符或已过期）
+    int Verify(int uid, const std::string& token) const;
+
+private:
+    std::string _key;
+    uint32_t _ttl_seconds;
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "TokenGenerator.h"
+
+// 令牌存储的统计数据，由健康检查周期输出，用于根据实际流量估算内存预算
+struct TokenStoreStats {
+    uint64_t hits = 0;       // 校验时找到了该uid的令牌
+    uint64_t misses = 0;     // 校验时没有该uid的令牌
+    uint64_t evictions = 0;  // 因内存预算被淘汰的令牌
+    std::size_t bytes = 0;   // 令牌表和过期定时项当前占用的内存
+};
+
+// 令牌存储后端接口
+// memory：本进程内的分片表（ShardedTokenStore）
+// redis ：写入Redis，多个StatusServer实例共享（RedisTokenStore）
+// 令牌以16字节二进制形式传入，文本解析和格式化由调用方在protobuf边界完成
+class TokenStore
+{
+public:
+    virtual ~TokenStore() = default;
+
+    // 写入令牌，返回true表示覆盖了该uid已有的令牌（后端无法判断时返回false）
+    virtual bool Insert(int uid, const TokenBytes& token) = 0;
+    // 批量写入，默认逐个调用Insert；后端可重写为整批只加一次锁
+    virtual void InsertBatch(const std::vector<std::pair<int, TokenBytes>>& tokens) {
+        for (const auto& item : tokens) {
+            Insert(item.first, item.second);
+        }
+    }
+    // 校验令牌，返回ErrorCodes：SUCCESS / UidInvalid / TokenInvalid
+    virtual int Verify(int uid, const TokenBytes& token) = 0;
+    // 由定时器周期调用，驱动过期等后台工作
+    virtual void Tick() {}
+    // 本进程内存中持有的令牌数
+    virtual std::size_t Size() const = 0;
+    // 过期时间轮上仍对应当前令牌的定时项数
+    virtual std::size_t LiveTimers() const { return 0; }
+    virtual TokenStoreStats Stats() const { return TokenStoreStats(); }
+    // 遍历本进程持有的有效令牌，用于向备机全量同步；默认没有可遍历的令牌
+    virtual void ForEachToken(const std::function<void(int uid, const TokenBytes& token)>& /*visit*/) const {}
+    // 快照读写，用于重启后恢复令牌；Redis后端的数据本来就在Redis里，默认不支持
+    virtual bool SaveSnapshot(const std::string& /*path*/, uint64_t /*tickMs*/) const { return false; }
+    virtual std::size_t LoadSnapshot(const std::string& /*path*/, uint64_t /*tickMs*/) { return 0; }
+    // 服务析构时调用，释放本进程持有的令牌数据
+    virtual void Clear() = 0;
+};
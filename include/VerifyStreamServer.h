@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include "message.grpc.pb.h"
+
+// 聊天服务器批量校验令牌的双向流（VerifyTokens）
+// 聊天服务器保持一条长连接，不断发送带request_id的校验请求，响应按request_id对应，
+// 不要求与请求同序。所有流都挂在同一个完成队列上，由少量线程轮询驱动，
+// 不会为每条流占用一个线程；同一条流上读和写可以同时进行。
+class VerifyStreamServer
+{
+public:
+    // 只把VerifyTokens标记为异步方法，其余RPC仍由同步线程池处理
+    using AsyncService = message::StatusService::WithAsyncMethod_VerifyTokens<message::StatusService::Service>;
+    // 校验回调，返回ErrorCodes
+    using Verifier = std::function<int(int uid, const std::string& token)>;
+
+    VerifyStreamServer(AsyncService* service, std::unique_ptr<grpc::ServerCompletionQueue> cq, Verifier verifier);
+    ~VerifyStreamServer();
+    VerifyStreamServer(const VerifyStreamServer&) = delete;
+    VerifyStreamServer& operator=(const VerifyStreamServer&) = delete;
+
+    // 开始接受流并启动threads个轮询线程，须在服务器BuildAndStart之后调用
+    void Start(std::size_t threads);
+    // 关闭完成队列并等待轮询线程退出，须在grpc::Server::Shutdown之后调用
+    void Shutdown();
+
+private:
+    class Call;
+
+    void run();
+
+    AsyncService* _service;
+    std::unique_ptr<grpc::ServerCompletionQueue> _cq;
+    Verifier _verifier;
+    std::vector<std::thread> _threads;
+    bool _b_stop;
+};
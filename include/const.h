@@ -48,6 +48,10 @@ enum ErrorCodes {
     PasswdInvalid = 1009,   // 登录密码无效
     RPCGetFailed = 1010,    // RPC无法获取聊天服务器
     ConnectionPoolFailed = 1011, // 无法获取池子中连接
+    ServerNotRegistered = 1012,  // 聊天服务器未注册（心跳方需要重新注册）
+    ServerInfoInvalid = 1013,    // 聊天服务器注册信息不完整
+    LogLevelInvalid = 1014,      // 无法识别的日志级别
+    ServerAlreadyRegistered = 1015, // 同名聊天服务器已被并发的注册请求加入
 
     // 数据相关错误码 (2000-2999)
     UserEmailExists = 2000,     // 用户或邮箱存在
@@ -64,4 +68,5 @@ enum ErrorCodes {
     UnknownError = 3003         // 未定义的错误
 };
 
-#define CODEPREFIX "code_"
\ No newline at end of file
+#define CODEPREFIX "code_"
+#define USERTOKENPREFIX "utoken_"
\ No newline at end of file
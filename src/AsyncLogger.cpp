@@ -0,0 +1,441 @@
+#include "AsyncLogger.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include "CoarseClock.h"
+#include "ConfigMgr.h"
+#include "LogFormat.h"
+
+namespace {
+
+std::size_t roundUpPowerOfTwo(std::size_t n)
+{
+    std::size_t capacity = 2;
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+// 把秒数格式化为"[YYYY-mm-dd HH:MM:SS] "，返回长度
+// 与粗粒度时钟同一秒时直接拷贝它已格式化好的字符串
+std::size_t formatPrefix(int64_t second, char (&out)[AsyncLogger::kPrefixSize])
+{
+    char timestamp[CoarseClock::kTimestampSize];
+    std::size_t length;
+    if (second == CoarseClock::NowSeconds()) {
+        CoarseClock::Timestamp(timestamp);
+        length = std::strlen(timestamp);
+    }
+    else {
+        length = CoarseClock::Format(second, timestamp);
+    }
+    std::memcpy(out, timestamp, length);
+    out[length] = ' ';
+    return length + 1;
+}
+
+const char* const kLevelTags[] = { "[DEBUG] ", "[INFO] ", "[WARN] ", "[ERROR] " };
+const char* const kLevelNames[] = { "debug", "info", "warn", "error", "off" };
+const std::size_t kLevelTagLengths[] = { 8, 7, 7, 8 };
+
+bool isErrorLevel(LogLevel level)
+{
+    return level >= LogLevel::Warn;
+}
+
+// 去掉空白并转为小写，用于解析配置值
+std::string normalize(const std::string& text)
+{
+    std::string lower;
+    for (char c : text) {
+        if (c != ' ' && c != '\t' && c != '\r') {
+            lower.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+        }
+    }
+    return lower;
+}
+
+// 二进制日志文件每次启动先写入的文件头，之后是'F'格式定义和'R'记录，整数均为本机字节序：
+//   'F' u32 id, u8 level, u32 line, u16 文件名长度, 文件名, u16 格式串长度, 格式串
+//   'R' u32 format_id, i64 time_ms, u8 level, u8 truncated, u16 length, text
+// 格式定义总是出现在引用它的记录之前；format_id为0的记录text是普通文本
+const char kBinaryMagic[8] = { 'B', 'J', 'S', 'T', 'L', 'O', 'G', '1' };
+
+template <typename T>
+void appendValue(std::string& buffer, T value)
+{
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void appendBytes(std::string& buffer, const std::string& bytes)
+{
+    auto length = static_cast<uint16_t>(std::min<std::size_t>(bytes.size(), UINT16_MAX));
+    appendValue(buffer, length);
+    buffer.append(bytes.data(), length);
+}
+
+// 记录正文：普通文本直接拷贝，格式记录按格式串展开
+void appendBody(const LogRecord& record, const LogFormatEntry* format, std::string& buffer)
+{
+    if (record.format_id == 0) {
+        buffer.append(record.text, record.length);
+    }
+    else if (format) {
+        RenderLogFormat(format->format, record.text, record.length, buffer);
+    }
+    else {
+        buffer.append("未知的日志格式 ");
+        buffer.append(std::to_string(record.format_id));
+    }
+}
+
+// 线程退出时通知后台线程回收缓冲
+struct RingHolder {
+    ~RingHolder() {
+        if (ring) {
+            ring->Close();
+        }
+    }
+    std::shared_ptr<LogRing> ring;
+};
+
+}
+
+LogRing::LogRing(std::size_t capacity)
+    : _head(0), _tail(0), _dropped(0), _closed(false), _writing(false),
+    _mask(roundUpPowerOfTwo(capacity) - 1), _records(new LogRecord[_mask + 1])
+{
+}
+
+std::atomic<bool> AsyncLogger::_stopped{ false };
+std::atomic<uint8_t> AsyncLogger::_level{ static_cast<uint8_t>(LogLevel::Info) };
+
+AsyncLogger::AsyncLogger()
+    : _total_dropped(0), _prefix_second(-1), _prefix_length(0), _binary_file(nullptr),
+    _formats_written(0), _b_stop(false)
+{
+    // [Log] FlushMs为后台线程写出的间隔，RingSize为每个线程缓冲的条数，
+    // Level为启动时的运行期级别（默认info，运行中可通过SetLogLevel RPC切换），Format为text或binary，
+    // BinaryPath为二进制日志文件（默认status.blog，追加写入）
+    auto& cfg = ConfigMgr::Inst();
+    if (normalize(cfg["Log"]["Format"]) == "binary") {
+        auto path = cfg["Log"]["BinaryPath"];
+        if (path.empty()) {
+            path = "status.blog";
+        }
+        _binary_file = std::fopen(path.c_str(), "ab");
+        if (_binary_file) {
+            _binary_buffer.append(kBinaryMagic, sizeof(kBinaryMagic));
+        }
+        else {
+            std::fprintf(stderr, "无法打开二进制日志文件 %s，改用文本日志\n", path.c_str());
+        }
+    }
+    LogLevel level;
+    if (ParseLevel(cfg["Log"]["Level"], level)) {
+        SetLevel(level);
+    }
+    auto flush = cfg["Log"]["FlushMs"];
+    auto ring_size = cfg["Log"]["RingSize"];
+    _flush_interval = std::chrono::milliseconds(flush.empty() ? 10 : std::max<long long>(1, std::stoll(flush)));
+    _ring_size = ring_size.empty() ? 1024 : std::max<std::size_t>(2, std::stoull(ring_size));
+    _thread = std::thread([this]() { run(); });
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    Stop();
+}
+
+bool AsyncLogger::ParseLevel(const std::string& text, LogLevel& level)
+{
+    std::string lower = normalize(text);
+    for (std::size_t i = 0; i < sizeof(kLevelNames) / sizeof(kLevelNames[0]); ++i) {
+        if (lower == kLevelNames[i]) {
+            level = static_cast<LogLevel>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* AsyncLogger::LevelName(LogLevel level)
+{
+    auto index = static_cast<std::size_t>(level);
+    return index < sizeof(kLevelNames) / sizeof(kLevelNames[0]) ? kLevelNames[index] : "unknown";
+}
+
+LogRing* AsyncLogger::ThreadRing()
+{
+    thread_local RingHolder holder;
+    if (_stopped.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    if (!holder.ring) {
+        holder.ring = GetInstance()->registerRing();
+    }
+    return holder.ring.get();
+}
+
+std::shared_ptr<LogRing> AsyncLogger::registerRing()
+{
+    auto ring = std::make_shared<LogRing>(_ring_size);
+    std::lock_guard<std::mutex> lock(_rings_mutex);
+    _rings.push_back(ring);
+    return ring;
+}
+
+void AsyncLogger::WriteDirect(const LogRecord& record)
+{
+    char prefix[kPrefixSize];
+    std::size_t length = formatPrefix(record.time_ms / 1000, prefix);
+    auto index = static_cast<std::size_t>(record.level);
+    std::string line(prefix, length);
+    line.append(kLevelTags[index], kLevelTagLengths[index]);
+    appendBody(record, record.format_id ? LogFormatRegistry::Find(record.format_id) : nullptr, line);
+    line.append(record.truncated ? "...\n" : "\n");
+    FILE* file = isErrorLevel(record.level) ? stderr : stdout;
+    std::fwrite(line.data(), 1, line.size(), file);
+    std::fflush(file);
+}
+
+void AsyncLogger::Stop()
+{
+    _stopped.store(true, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_b_stop) {
+            return;
+        }
+        _b_stop = true;
+    }
+    _cond.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    if (_binary_file) {
+        std::fclose(_binary_file);
+        _binary_file = nullptr;
+    }
+}
+
+void AsyncLogger::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        bool stop = _cond.wait_for(lock, _flush_interval, [this] { return _b_stop; });
+        lock.unlock();
+        drain();
+        // 每批只写一次、刷新一次
+        if (!_out_buffer.empty()) {
+            std::fwrite(_out_buffer.data(), 1, _out_buffer.size(), stdout);
+            std::fflush(stdout);
+            _out_buffer.clear();
+        }
+        if (!_err_buffer.empty()) {
+            std::fwrite(_err_buffer.data(), 1, _err_buffer.size(), stderr);
+            std::fflush(stderr);
+            _err_buffer.clear();
+        }
+        if (!_binary_buffer.empty()) {
+            std::fwrite(_binary_buffer.data(), 1, _binary_buffer.size(), _binary_file);
+            std::fflush(_binary_file);
+            _binary_buffer.clear();
+        }
+        if (stop) {
+            break;
+        }
+        lock.lock();
+    }
+}
+
+void AsyncLogger::drain()
+{
+    std::lock_guard<std::mutex> lock(_rings_mutex);
+    for (auto iter = _rings.begin(); iter != _rings.end();) {
+        auto& ring = *iter;
+        // 先判断是否已关闭再取记录，保证关闭前发布的记录都被取走
+        bool closed = ring->Closed();
+        ring->Drain([this](const LogRecord& record) { append(record); });
+        auto dropped = ring->TakeDropped();
+        if (dropped > 0) {
+            _total_dropped.fetch_add(dropped, std::memory_order_relaxed);
+            LogRecord notice;
+            notice.time_ms = CoarseClock::NowMs();
+            notice.level = LogLevel::Warn;
+            notice.truncated = false;
+            notice.format_id = 0;
+            int length = std::snprintf(notice.text, sizeof(notice.text),
+                "日志缓冲已满，丢弃 %llu 条日志", static_cast<unsigned long long>(dropped));
+            notice.length = static_cast<uint16_t>(std::min<int>(std::max(0, length), sizeof(notice.text) - 1));
+            append(notice);
+        }
+        if (closed) {
+            iter = _rings.erase(iter);
+        }
+        else {
+            ++iter;
+        }
+    }
+}
+
+void AsyncLogger::append(const LogRecord& record)
+{
+    if (_binary_file) {
+        appendBinary(record);
+        // 二进制日志需要解码才能看，警告和错误仍然直接输出
+        if (isErrorLevel(record.level)) {
+            appendText(record, _err_buffer);
+        }
+    }
+    else {
+        appendText(record, isErrorLevel(record.level) ? _err_buffer : _out_buffer);
+    }
+}
+
+void AsyncLogger::appendText(const LogRecord& record, std::string& buffer)
+{
+    // 同一秒内的日志共用一次时间格式化
+    int64_t second = record.time_ms / 1000;
+    if (second != _prefix_second) {
+        _prefix_length = formatPrefix(second, _prefix);
+        _prefix_second = second;
+    }
+    auto index = static_cast<std::size_t>(record.level);
+    buffer.append(_prefix, _prefix_length);
+    buffer.append(kLevelTags[index], kLevelTagLengths[index]);
+    appendBody(record, record.format_id ? format(record.format_id) : nullptr, buffer);
+    buffer.append(record.truncated ? "...\n" : "\n");
+}
+
+void AsyncLogger::appendBinary(const LogRecord& record)
+{
+    if (record.format_id > _formats_written) {
+        appendFormats(record.format_id);
+    }
+    _binary_buffer.push_back('R');
+    appendValue(_binary_buffer, record.format_id);
+    appendValue(_binary_buffer, record.time_ms);
+    appendValue(_binary_buffer, static_cast<uint8_t>(record.level));
+    appendValue(_binary_buffer, static_cast<uint8_t>(record.truncated ? 1 : 0));
+    appendValue(_binary_buffer, record.length);
+    _binary_buffer.append(record.text, record.length);
+}
+
+void AsyncLogger::appendFormats(uint32_t id)
+{
+    for (uint32_t next = _formats_written + 1; next <= id; ++next) {
+        auto entry = format(next);
+        if (!entry) {
+            break;
+        }
+        _binary_buffer.push_back('F');
+        appendValue(_binary_buffer, entry->id);
+        appendValue(_binary_buffer, static_cast<uint8_t>(entry->level));
+        appendValue(_binary_buffer, entry->line);
+        appendBytes(_binary_buffer, entry->file);
+        appendBytes(_binary_buffer, entry->format);
+        _formats_written = next;
+    }
+}
+
+const LogFormatEntry* AsyncLogger::format(uint32_t id)
+{
+    if (id < _formats.size() && _formats[id]) {
+        return _formats[id];
+    }
+    auto entry = LogFormatRegistry::Find(id);
+    if (entry) {
+        if (id >= _formats.size()) {
+            _formats.resize(id + 1, nullptr);
+        }
+        _formats[id] = entry;
+    }
+    return entry;
+}
+
+LogLine::LogLine(LogLevel level)
+    : _ring(AsyncLogger::ThreadRing()), _record(nullptr)
+{
+    if (_ring) {
+        _record = _ring->Reserve();
+    }
+    else {
+        _direct.reset(new LogRecord);
+        _record = _direct.get();
+    }
+    if (_record) {
+        _record->time_ms = CoarseClock::NowMs();
+        _record->length = 0;
+        _record->level = level;
+        _record->truncated = false;
+        _record->format_id = 0;
+    }
+}
+
+LogLine::~LogLine()
+{
+    if (_direct) {
+        AsyncLogger::WriteDirect(*_direct);
+    }
+    else if (_record) {
+        _ring->Commit();
+    }
+}
+
+void LogLine::append(const char* data, std::size_t size)
+{
+    if (!_record) {
+        return;
+    }
+    std::size_t room = LogRecord::kTextSize - _record->length;
+    if (size > room) {
+        size = room;
+        _record->truncated = true;
+    }
+    std::memcpy(_record->text + _record->length, data, size);
+    _record->length = static_cast<uint16_t>(_record->length + size);
+}
+
+LogLine& LogLine::operator<<(const char* text)
+{
+    append(text, std::strlen(text));
+    return *this;
+}
+
+LogLine& LogLine::operator<<(const std::string& text)
+{
+    append(text.data(), text.size());
+    return *this;
+}
+
+LogLine& LogLine::operator<<(char c)
+{
+    append(&c, 1);
+    return *this;
+}
+
+LogLine& LogLine::operator<<(double value)
+{
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+    append(buffer, length > 0 ? static_cast<std::size_t>(length) : 0);
+    return *this;
+}
+
+void LogLine::appendSigned(long long value)
+{
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    append(buffer, result.ptr - buffer);
+}
+
+void LogLine::appendUnsigned(unsigned long long value)
+{
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    append(buffer, result.ptr - buffer);
+}
@@ -0,0 +1,417 @@
+#include "ChatServerRegistry.h"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <thread>
+
+namespace {
+
+// 每个线程一份xorshift64*随机数发生器，抽样时不需要任何同步
+uint64_t nextRandom()
+{
+    thread_local uint64_t state = [] {
+        std::random_device rd;
+        uint64_t seed = (uint64_t(rd()) << 32) ^ rd()
+            ^ std::hash<std::thread::id>()(std::this_thread::get_id());
+        return seed == 0 ? 0x9E3779B97F4A7C15ull : seed;
+    }();
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1Dull;
+}
+
+// FNV-1a，跨进程、跨平台结果一致，多个StatusServer实例会把同一uid映射到同一台服务器
+uint64_t fnv1a(const std::string& data)
+{
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (unsigned char c : data) {
+        h ^= c;
+        h *= 0x100000001B3ull;
+    }
+    return h;
+}
+
+// splitmix64 的终结函数，把 uid 和服务器哈希混合成均匀分布的64位值
+uint64_t mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+    return x;
+}
+
+int64_t steadyNowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+ChatServer::ChatServer(std::size_t id, const std::string& name, const std::string& host, const std::string& port, int weight,
+    double phiMinStdDevMs, double acceptablePauseMs)
+    : id(id), host(host), port(port), name(name), weight(weight), name_hash(fnv1a(name)), con_count(0),
+    pending_leases(0), removed(false), detector(100, phiMinStdDevMs, acceptablePauseMs)
+{
+}
+
+ChatServerRegistry::ChatServerRegistry()
+    : _snapshot(std::make_shared<const ChatServerSnapshot>()),
+    _policy(BalancePolicy::LeastConnections),
+    _next_id(0),
+    _total_connections(0),
+    _load_factor(1.25),
+    _phi_min_std_dev(100.0),
+    _acceptable_pause(0.0)
+{
+}
+
+void ChatServerRegistry::SetFailureDetector(double minStdDevMs, double acceptablePauseMs)
+{
+    std::lock_guard<std::mutex> guard(_writer_mutex);
+    _phi_min_std_dev = minStdDevMs > 0 ? minStdDevMs : 100.0;
+    _acceptable_pause = acceptablePauseMs > 0 ? acceptablePauseMs : 0.0;
+}
+
+std::shared_ptr<const ChatServerSnapshot> ChatServerRegistry::Snapshot() const
+{
+    return std::atomic_load(&_snapshot);
+}
+
+void ChatServerRegistry::publish(std::shared_ptr<const ChatServerSnapshot> snapshot)
+{
+    std::atomic_store(&_snapshot, std::move(snapshot));
+}
+
+void ChatServerRegistry::publishLeast()
+{
+    std::shared_ptr<ChatServer> least;
+    if (!_heap.Empty()) {
+        least = _heap_servers[_heap.Top()];
+    }
+    std::atomic_store(&_least, std::move(least));
+}
+
+int64_t ChatServerRegistry::heapKey(const ChatServer& server, int count) const
+{
+    if (Policy() == BalancePolicy::WeightedLeastLoad) {
+        // 放大2^20倍再除以权重，保留足够的精度区分不同权重的服务器；
+        // 计数在释放和覆盖交错时可能短暂为负，用乘法而不是左移，负数也有定义
+        return static_cast<int64_t>(count) * (int64_t(1) << 20) / server.weight;
+    }
+    return count;
+}
+
+bool ChatServerRegistry::Add(const std::string& name, const std::string& host, const std::string& port, int weight)
+{
+    std::lock_guard<std::mutex> guard(_writer_mutex);
+    auto current = Snapshot();
+    if (current->by_name.count(name) > 0) {
+        return false;
+    }
+
+    // 复制一份新快照，服务器对象本身共享，已有服务器的负载计数不受影响
+    auto next = std::make_shared<ChatServerSnapshot>(*current);
+    auto server = std::make_shared<ChatServer>(_next_id++, name, host, port, weight < 1 ? 1 : weight,
+        _phi_min_std_dev, _acceptable_pause);
+    // 注册本身算作第一次心跳，之后再收到一次心跳就有了间隔样本，
+    // 注册后只发过一次心跳就宕机的服务器也能被检测到
+    server->detector.Heartbeat(steadyNowMs());
+    next->servers.push_back(server);
+    next->by_name.emplace(name, server);
+    next->total_weight += server->weight;
+
+    if (heapEnabled()) {
+        std::lock_guard<std::mutex> heap_guard(_heap_mutex);
+        _heap.Push(server->id, heapKey(*server, server->con_count.load()));
+        _heap_servers.emplace(server->id, server);
+        publishLeast();
+    }
+    publish(std::move(next));
+    return true;
+}
+
+bool ChatServerRegistry::Remove(const std::string& name)
+{
+    std::lock_guard<std::mutex> guard(_writer_mutex);
+    auto current = Snapshot();
+    auto iter = current->by_name.find(name);
+    if (iter == current->by_name.end()) {
+        return false;
+    }
+    auto server = iter->second;
+
+    auto next = std::make_shared<ChatServerSnapshot>();
+    next->servers.reserve(current->servers.size() - 1);
+    for (const auto& item : current->servers) {
+        if (item != server) {
+            next->servers.push_back(item);
+            next->by_name.emplace(item->name, item);
+            next->total_weight += item->weight;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> heap_guard(_heap_mutex);
+        if (_heap.Contains(server->id)) {
+            _heap.Erase(server->id);
+            _heap_servers.erase(server->id);
+            publishLeast();
+        }
+        // 先打标记再扣除，之后租约到期、释放或旧快照上的分配都不会再改动总数
+        server->removed.store(true);
+        _total_connections.fetch_sub(server->con_count.load(), std::memory_order_relaxed);
+    }
+    // 正在使用旧快照的读者仍可能选中它，这部分请求会在下一次快照加载后消失
+    publish(std::move(next));
+    return true;
+}
+
+bool ChatServerRegistry::Heartbeat(const std::string& name, int count)
+{
+    auto server = Find(name);
+    if (!server) {
+        return false;
+    }
+    server->detector.Heartbeat(steadyNowMs());
+    SetConnections(server, count);
+    return true;
+}
+
+std::vector<std::string> ChatServerRegistry::CollectSuspects(double phiThreshold) const
+{
+    std::vector<std::string> suspects;
+    auto now = steadyNowMs();
+    // 先持有快照再遍历，临时的shared_ptr在范围for开始后就会释放，并发下线时快照可能被回收
+    auto snapshot = Snapshot();
+    for (const auto& server : snapshot->servers) {
+        if (server->detector.Phi(now) > phiThreshold) {
+            suspects.push_back(server->name);
+        }
+    }
+    return suspects;
+}
+
+void ChatServerRegistry::SetPolicy(BalancePolicy policy)
+{
+    std::lock_guard<std::mutex> guard(_writer_mutex);
+    std::lock_guard<std::mutex> heap_guard(_heap_mutex);
+    _policy.store(policy, std::memory_order_relaxed);
+
+    _heap.Clear();
+    _heap_servers.clear();
+    if (heapEnabled()) {
+        // 与CollectSuspects一样先持有快照，不依赖持有_writer_mutex时快照不会被替换
+        auto snapshot = Snapshot();
+        for (const auto& server : snapshot->servers) {
+            _heap.Push(server->id, heapKey(*server, server->con_count.load()));
+            _heap_servers.emplace(server->id, server);
+        }
+    }
+    publishLeast();
+}
+
+void ChatServerRegistry::updateHeap(const ChatServer& server, int count)
+{
+    if (_heap.Contains(server.id)) {
+        std::size_t top = _heap.Top();
+        _heap.Update(server.id, heapKey(server, count));
+        if (_heap.Top() != top) {
+            publishLeast();
+        }
+    }
+}
+
+void ChatServerRegistry::addTotal(const ChatServer& server, int64_t delta)
+{
+    // 堆策略下与Remove在同一把锁内，结果是精确的；其他策略不加锁，
+    // 只有恰好与下线同时发生的那一次修改可能算错，不会随租约到期或释放持续累积
+    if (!server.removed.load()) {
+        _total_connections.fetch_add(delta, std::memory_order_relaxed);
+    }
+}
+
+int ChatServerRegistry::AddConnections(const std::shared_ptr<ChatServer>& server, int delta)
+{
+    if (!heapEnabled()) {
+        int before = server->con_count.fetch_add(delta, std::memory_order_relaxed);
+        addTotal(*server, delta);
+        return before;
+    }
+
+    // 计数和堆在同一把锁内修改，保证堆里的键和计数一致
+    std::lock_guard<std::mutex> heap_guard(_heap_mutex);
+    int before = server->con_count.fetch_add(delta, std::memory_order_relaxed);
+    addTotal(*server, delta);
+    updateHeap(*server, before + delta);
+    return before;
+}
+
+std::vector<std::shared_ptr<ChatServer>> ChatServerRegistry::AssignBatch(const std::vector<int>& uids)
+{
+    std::vector<std::shared_ptr<ChatServer>> assigned;
+    assigned.reserve(uids.size());
+    int64_t total = 0;
+
+    if (!heapEnabled()) {
+        // 随机两选一和会话亲和本身不加锁，逐个选择并计数，后面的uid能看到前面的分配
+        for (int uid : uids) {
+            auto server = Select(uid);
+            if (server) {
+                server->con_count.fetch_add(1, std::memory_order_relaxed);
+                addTotal(*server, 1);
+            }
+            assigned.push_back(std::move(server));
+        }
+        return assigned;
+    }
+
+    std::lock_guard<std::mutex> heap_guard(_heap_mutex);
+    for (std::size_t i = 0; i < uids.size(); ++i) {
+        if (_heap.Empty()) {
+            assigned.emplace_back();
+            continue;
+        }
+        const auto& server = _heap_servers[_heap.Top()];
+        int count = server->con_count.fetch_add(1, std::memory_order_relaxed) + 1;
+        // 直接调整堆，批次结束后再统一发布堆顶
+        _heap.Update(server->id, heapKey(*server, count));
+        assigned.push_back(server);
+        ++total;
+    }
+    _total_connections.fetch_add(total, std::memory_order_relaxed);
+    publishLeast();
+    return assigned;
+}
+
+int ChatServerRegistry::SetConnections(const std::shared_ptr<ChatServer>& server, int count)
+{
+    count += server->pending_leases.load(std::memory_order_relaxed);
+    if (!heapEnabled()) {
+        int before = server->con_count.exchange(count, std::memory_order_relaxed);
+        addTotal(*server, count - before);
+        return before;
+    }
+
+    std::lock_guard<std::mutex> heap_guard(_heap_mutex);
+    int before = server->con_count.exchange(count, std::memory_order_relaxed);
+    addTotal(*server, count - before);
+    updateHeap(*server, count);
+    return before;
+}
+
+std::shared_ptr<ChatServer> ChatServerRegistry::Select(int uid) const
+{
+    switch (Policy()) {
+    case BalancePolicy::TwoChoices:
+        return SelectTwoChoices();
+    case BalancePolicy::Affinity:
+        return SelectAffinity(uid);
+    case BalancePolicy::LeastConnections:
+    case BalancePolicy::WeightedLeastLoad:
+    default:
+        return SelectLeastLoaded();
+    }
+}
+
+std::shared_ptr<ChatServer> ChatServerRegistry::SelectTwoChoices() const
+{
+    auto snapshot = Snapshot();
+    const auto& servers = snapshot->servers;
+    std::size_t n = servers.size();
+    if (n == 0) {
+        return nullptr;
+    }
+    if (n == 1) {
+        return servers[0];
+    }
+
+    // 抽两个不同的下标
+    uint64_t r = nextRandom();
+    std::size_t a = static_cast<std::size_t>(r % n);
+    std::size_t b = static_cast<std::size_t>((r >> 32) % (n - 1));
+    if (b >= a) {
+        ++b;
+    }
+
+    int countA = servers[a]->con_count.load(std::memory_order_relaxed);
+    int countB = servers[b]->con_count.load(std::memory_order_relaxed);
+    return countB < countA ? servers[b] : servers[a];
+}
+
+std::shared_ptr<ChatServer> ChatServerRegistry::SelectAffinity(int uid) const
+{
+    auto snapshot = Snapshot();
+    const auto& servers = snapshot->servers;
+    if (servers.empty()) {
+        return nullptr;
+    }
+
+    // 本次分配之后的平均负载，按权重分摊得到每台的上限
+    double total = static_cast<double>(_total_connections.load(std::memory_order_relaxed) + 1);
+    double perWeight = _load_factor * total / static_cast<double>(snapshot->total_weight);
+
+    uint64_t key = mix64(static_cast<uint32_t>(uid));
+    std::size_t best = servers.size();
+    std::size_t fallback = 0;
+    double bestScore = -1.0;
+    double fallbackScore = -1.0;
+    for (std::size_t i = 0; i < servers.size(); ++i) {
+        const auto& server = *servers[i];
+        // 加权HRW得分：-w / ln(u)，u为(0,1)内的均匀值
+        double u = (static_cast<double>(mix64(key ^ server.name_hash) >> 11) + 0.5) / 9007199254740992.0;
+        double score = -static_cast<double>(server.weight) / std::log(u);
+        if (score > fallbackScore) {
+            fallbackScore = score;
+            fallback = i;
+        }
+        double cap = std::ceil(perWeight * server.weight);
+        if (server.con_count.load(std::memory_order_relaxed) < cap && score > bestScore) {
+            bestScore = score;
+            best = i;
+        }
+    }
+    // 并发修改计数时可能出现全部超限，退回到得分最高的服务器
+    return servers[best < servers.size() ? best : fallback];
+}
+
+std::shared_ptr<ChatServer> ChatServerRegistry::SelectLeastLoaded() const
+{
+    return std::atomic_load(&_least);
+}
+
+std::shared_ptr<ChatServer> ChatServerRegistry::Find(const std::string& name) const
+{
+    auto snapshot = Snapshot();
+    auto iter = snapshot->by_name.find(name);
+    if (iter == snapshot->by_name.end()) {
+        return nullptr;
+    }
+    return iter->second;
+}
+
+std::size_t ChatServerRegistry::Size() const
+{
+    return Snapshot()->servers.size();
+}
+
+void ChatServerRegistry::Clear()
+{
+    std::lock_guard<std::mutex> guard(_writer_mutex);
+    {
+        std::lock_guard<std::mutex> heap_guard(_heap_mutex);
+        _heap.Clear();
+        _heap_servers.clear();
+        publishLeast();
+        auto snapshot = Snapshot();
+        for (const auto& server : snapshot->servers) {
+            server->removed.store(true);
+        }
+        _total_connections.store(0, std::memory_order_relaxed);
+    }
+    publish(std::make_shared<const ChatServerSnapshot>());
+}
@@ -0,0 +1,116 @@
+#include "CoarseClock.h"
+#include <condition_variable>
+#include <cstring>
+#include <ctime>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+constexpr std::size_t kTimestampSlots = 8;
+
+// 刷新线程及其状态，静态析构时自动停止线程
+struct Ticker {
+    ~Ticker() { CoarseClock::Stop(); }
+
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::thread thread;
+    bool running = false;
+    bool b_stop = false;
+
+    // 只在刷新线程里写
+    char timestamps[kTimestampSlots][CoarseClock::kTimestampSize];
+    std::size_t next_slot = 0;
+    int64_t timestamp_second = -1;
+};
+
+Ticker g_ticker;
+
+}
+
+std::atomic<int64_t> CoarseClock::_now_ms{ 0 };
+std::atomic<const char*> CoarseClock::_timestamp{ nullptr };
+
+int64_t CoarseClock::preciseNowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+std::size_t CoarseClock::Format(int64_t seconds, char (&out)[kTimestampSize])
+{
+    std::time_t time = static_cast<std::time_t>(seconds);
+    std::tm tm{};
+#ifdef _WIN32
+    localtime_s(&tm, &time);
+#else
+    localtime_r(&time, &tm);
+#endif
+    return std::strftime(out, kTimestampSize, "[%Y-%m-%d %H:%M:%S]", &tm);
+}
+
+void CoarseClock::Timestamp(char (&out)[kTimestampSize])
+{
+    const char* current = _timestamp.load(std::memory_order_acquire);
+    if (current) {
+        std::memcpy(out, current, kTimestampSize);
+    }
+    else {
+        Format(preciseNowMs() / 1000, out);
+    }
+}
+
+void CoarseClock::refresh()
+{
+    int64_t now = preciseNowMs();
+    _now_ms.store(now, std::memory_order_relaxed);
+    // 字符串每秒才变化一次，只在跨秒时重新格式化
+    int64_t second = now / 1000;
+    if (second != g_ticker.timestamp_second) {
+        auto& slot = g_ticker.timestamps[g_ticker.next_slot];
+        Format(second, slot);
+        _timestamp.store(slot, std::memory_order_release);
+        g_ticker.next_slot = (g_ticker.next_slot + 1) % kTimestampSlots;
+        g_ticker.timestamp_second = second;
+    }
+}
+
+void CoarseClock::run(std::chrono::milliseconds tick)
+{
+    std::unique_lock<std::mutex> lock(g_ticker.mutex);
+    while (!g_ticker.cond.wait_for(lock, tick, [] { return g_ticker.b_stop; })) {
+        refresh();
+    }
+}
+
+void CoarseClock::Start(std::chrono::milliseconds tick)
+{
+    std::lock_guard<std::mutex> lock(g_ticker.mutex);
+    if (g_ticker.running) {
+        return;
+    }
+    // 先刷新一次，Start返回后读到的就是粗粒度时间
+    refresh();
+    g_ticker.running = true;
+    g_ticker.b_stop = false;
+    g_ticker.thread = std::thread([tick]() { run(tick); });
+}
+
+void CoarseClock::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(g_ticker.mutex);
+        if (!g_ticker.running) {
+            return;
+        }
+        g_ticker.b_stop = true;
+        g_ticker.running = false;
+    }
+    g_ticker.cond.notify_all();
+    if (g_ticker.thread.joinable()) {
+        g_ticker.thread.join();
+    }
+    _now_ms.store(0, std::memory_order_relaxed);
+    _timestamp.store(nullptr, std::memory_order_release);
+}
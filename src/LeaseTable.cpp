@@ -0,0 +1,109 @@
+#include "LeaseTable.h"
+
+LeaseTable::LeaseTable(ChatServerRegistry& registry, uint64_t ttlTicks)
+    : _registry(registry), _ttl_ticks(ttlTicks == 0 ? 1 : ttlTicks), _next_generation(0)
+{
+}
+
+void LeaseTable::release(const std::shared_ptr<ChatServer>& server)
+{
+    server->pending_leases.fetch_sub(1, std::memory_order_relaxed);
+    _registry.AddConnections(server, -1);
+}
+
+int LeaseTable::Grant(int uid, const std::shared_ptr<ChatServer>& server)
+{
+    server->pending_leases.fetch_add(1, std::memory_order_relaxed);
+    int count = _registry.AddConnections(server, 1);
+
+    std::shared_ptr<ChatServer> previous;
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        auto generation = ++_next_generation;
+        auto& lease = _leases[uid];
+        previous.swap(lease.server);
+        lease.server = server;
+        lease.generation = generation;
+        // 旧预留的定时项不用删除，到期时发现代数不匹配会直接忽略
+        _wheel.Add(_ttl_ticks, Expiry{ uid, generation });
+    }
+    if (previous) {
+        // 同一用户重复获取服务器，上一次分配视为作废
+        release(previous);
+    }
+    return count;
+}
+
+void LeaseTable::GrantBatch(const std::vector<int>& uids, const std::vector<std::shared_ptr<ChatServer>>& servers)
+{
+    std::vector<std::shared_ptr<ChatServer>> previous;
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        for (std::size_t i = 0; i < uids.size() && i < servers.size(); ++i) {
+            if (!servers[i]) {
+                continue;
+            }
+            servers[i]->pending_leases.fetch_add(1, std::memory_order_relaxed);
+            auto generation = ++_next_generation;
+            auto& lease = _leases[uids[i]];
+            if (lease.server) {
+                previous.push_back(std::move(lease.server));
+            }
+            lease.server = servers[i];
+            lease.generation = generation;
+            _wheel.Add(_ttl_ticks, Expiry{ uids[i], generation });
+        }
+    }
+    for (const auto& server : previous) {
+        release(server);
+    }
+}
+
+bool LeaseTable::Confirm(int uid)
+{
+    std::shared_ptr<ChatServer> server;
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        auto iter = _leases.find(uid);
+        if (iter == _leases.end()) {
+            return false;
+        }
+        server = std::move(iter->second.server);
+        _leases.erase(iter);
+    }
+    // 连接数已在分配时计入，这里只撤销预留标记
+    server->pending_leases.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+void LeaseTable::Tick()
+{
+    std::vector<std::shared_ptr<ChatServer>> expired;
+    {
+        std::lock_guard<std::mutex> guard(_mutex);
+        _wheel.Tick([&expired, this](Expiry& expiry) {
+            auto iter = _leases.find(expiry.uid);
+            if (iter == _leases.end() || iter->second.generation != expiry.generation) {
+                return; // 已确认或已被新的分配替换
+            }
+            expired.push_back(std::move(iter->second.server));
+            _leases.erase(iter);
+            });
+    }
+    for (const auto& server : expired) {
+        release(server);
+    }
+}
+
+std::size_t LeaseTable::Size() const
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    return _leases.size();
+}
+
+void LeaseTable::Clear()
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    _leases.clear();
+    _wheel = TimingWheel<Expiry>();
+}
@@ -0,0 +1,137 @@
+#include "LogFormat.h"
+#include <charconv>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+
+namespace {
+
+// 登记表在第一次登记时构造，不依赖各编译单元静态初始化的先后顺序
+struct Registry {
+    std::mutex mutex;
+    std::deque<LogFormatEntry> entries; // deque追加时不移动已有条目
+};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+template <typename T>
+bool readValue(const char*& cursor, const char* end, T& value)
+{
+    if (static_cast<std::size_t>(end - cursor) < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, cursor, sizeof(T));
+    cursor += sizeof(T);
+    return true;
+}
+
+// 展开一个参数，数据不完整或类型无法识别时返回false
+bool renderArg(const char*& cursor, const char* end, std::string& out)
+{
+    if (cursor >= end) {
+        return false;
+    }
+    char type = *cursor++;
+    char buffer[32];
+    switch (type) {
+    case 'i': {
+        int64_t value;
+        if (!readValue(cursor, end, value)) {
+            return false;
+        }
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr - buffer);
+        return true;
+    }
+    case 'u': {
+        uint64_t value;
+        if (!readValue(cursor, end, value)) {
+            return false;
+        }
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr - buffer);
+        return true;
+    }
+    case 'd': {
+        double value;
+        if (!readValue(cursor, end, value)) {
+            return false;
+        }
+        int length = std::snprintf(buffer, sizeof(buffer), "%g", value);
+        out.append(buffer, length > 0 ? static_cast<std::size_t>(length) : 0);
+        return true;
+    }
+    case 'c':
+        if (cursor >= end) {
+            return false;
+        }
+        out.push_back(*cursor++);
+        return true;
+    case 's': {
+        uint16_t length;
+        if (!readValue(cursor, end, length) || static_cast<std::size_t>(end - cursor) < length) {
+            return false;
+        }
+        out.append(cursor, length);
+        cursor += length;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
+}
+
+uint32_t LogFormatRegistry::Register(LogLevel level, const char* file, uint32_t line, const char* format)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    uint32_t id = static_cast<uint32_t>(reg.entries.size() + 1);
+    reg.entries.push_back(LogFormatEntry{ id, level, line, file, format });
+    return id;
+}
+
+const LogFormatEntry* LogFormatRegistry::Find(uint32_t id)
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    if (id == 0 || id > reg.entries.size()) {
+        return nullptr;
+    }
+    return &reg.entries[id - 1];
+}
+
+uint32_t LogFormatRegistry::Size()
+{
+    auto& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    return static_cast<uint32_t>(reg.entries.size());
+}
+
+void RenderLogFormat(const std::string& format, const char* args, std::size_t length, std::string& out)
+{
+    const char* cursor = args;
+    const char* end = args + length;
+    bool has_args = true;
+    std::size_t begin = 0;
+    while (true) {
+        // 占位符之间的文字整段拷贝
+        std::size_t next = format.find("{}", begin);
+        if (next == std::string::npos) {
+            out.append(format, begin, std::string::npos);
+            return;
+        }
+        out.append(format, begin, next - begin);
+        // 参数因截断缺失时保留占位符
+        if (!has_args || !renderArg(cursor, end, out)) {
+            has_args = false;
+            out.append("{}");
+        }
+        begin = next + 2;
+    }
+}
@@ -1,4 +1,6 @@
 #include "MySqlDao.h"
+#include "AsyncLogger.h"
+#include "CoarseClock.h"
 
 SqlConnection::SqlConnection(sql::Connection* con, int64_t lasttime)
     :_con(con), _last_oper_time(lasttime)
@@ -14,8 +16,7 @@ MySqlPool::MySqlPool(const std::string& url, const std::string& user, const std:
             sql::mysql::MySQL_Driver* driver = sql::mysql::get_driver_instance();
             sql::Connection* con = driver->connect(url_, user_, pass_);
             con->setSchema(schema_);
-            auto CurrentTime = std::chrono::system_clock::now().time_since_epoch();
-            long long timestamp = std::chrono::duration_cast<std::chrono::seconds>(CurrentTime).count();
+            long long timestamp = CoarseClock::NowSeconds();
             // 记录连接和最后操作时间
             pool_.push(std::make_unique<SqlConnection>(con, timestamp));
         }
@@ -28,18 +29,18 @@ MySqlPool::MySqlPool(const std::string& url, const std::string& user, const std:
         _check_thread.detach(); // 分离线程，交给系统管理
     }
     catch (sql::SQLException& e) {
-        std::cerr << "Error: " << e.what() << std::endl;
+        LOG_ERROR << "Error: " << e.what();
         // 清理已创建的连接
         Close();
         throw; // 重新抛出异常，让调用者知道初始化失败
     }
     catch (std::exception& e) {
-        std::cerr << "Error: " << e.what() << std::endl;
+        LOG_ERROR << "Error: " << e.what();
         Close();
         throw;
     }
     catch (...) {
-        std::cerr << "Unknown error" << std::endl;
+        LOG_ERROR << "Unknown error";
         Close();
         throw;
     }
@@ -51,8 +52,7 @@ void MySqlPool::checkConnection()
 
     // 创建临时队列存储连接
     std::queue<std::unique_ptr<SqlConnection>> tempPool;
-    auto currentTime = std::chrono::system_clock::now().time_since_epoch();
-    long long timestamp = std::chrono::duration_cast<std::chrono::seconds>(currentTime).count();
+    long long timestamp = CoarseClock::NowSeconds();
 
     // 检查所有连接
     while (!pool_.empty()) {
@@ -69,11 +69,11 @@ void MySqlPool::checkConnection()
             std::unique_ptr<sql::PreparedStatement> pstmt(con->_con->prepareStatement("SELECT 1"));
             pstmt->execute();
             con->_last_oper_time = timestamp; // 更新最后操作时间
-            std::cout << "MySQL链接存活，操作时间为：" << timestamp << std::endl;
+            LOG_DEBUG << "MySQL链接存活，操作时间为：" << timestamp;
             tempPool.push(std::move(con));
         }
         catch (sql::SQLException& e) {
-            std::cerr << "MySQL链接失效，重新创建连接，错误为：" << e.what() << std::endl;
+            LOG_WARN << "MySQL链接失效，重新创建连接，错误为：" << e.what();
             try {
                 sql::mysql::MySQL_Driver* driver = sql::mysql::get_driver_instance();
                 sql::Connection* newCon = driver->connect(url_, user_, pass_);
@@ -82,17 +82,17 @@ void MySqlPool::checkConnection()
                 tempPool.push(std::move(con));
             }
             catch (std::exception& ex) {
-                std::cerr << "重新创建连接失败: " << ex.what() << std::endl;
+                LOG_ERROR << "重新创建连接失败: " << ex.what();
                 // 连接无法恢复，池大小减少
             }
         }
         catch (std::exception& e) {
-            std::cerr << "Error: " << e.what() << std::endl;
+            LOG_ERROR << "Error: " << e.what();
             // 尝试保留连接，避免池耗尽
             tempPool.push(std::move(con));
         }
         catch (...) {
-            std::cerr << "Unknown error" << std::endl;
+            LOG_ERROR << "Unknown error";
             // 尝试保留连接，避免池耗尽
             tempPool.push(std::move(con));
         }
@@ -107,13 +107,12 @@ void MySqlPool::checkConnection()
             sql::mysql::MySQL_Driver* driver = sql::mysql::get_driver_instance();
             sql::Connection* newCon = driver->connect(url_, user_, pass_);
             newCon->setSchema(schema_);
-            auto CurrentTime = std::chrono::system_clock::now().time_since_epoch();
-            long long timestamp = std::chrono::duration_cast<std::chrono::seconds>(CurrentTime).count();
+            long long timestamp = CoarseClock::NowSeconds();
             pool_.push(std::make_unique<SqlConnection>(newCon, timestamp));
-            std::cout << "补充新的MySQL连接到池中" << std::endl;
+            LOG_INFO << "补充新的MySQL连接到池中";
         }
         catch (std::exception& e) {
-            std::cerr << "补充连接失败: " << e.what() << std::endl;
+            LOG_ERROR << "补充连接失败: " << e.what();
             break; // 不能创建新连接，停止尝试
         }
     }
@@ -139,10 +138,8 @@ std::unique_ptr<SqlConnection> MySqlPool::getConnection()
     std::unique_ptr<SqlConnection> con = std::move(pool_.front());
     pool_.pop();
 
-    // 更新最后操作时间
-    auto currentTime = std::chrono::system_clock::now().time_since_epoch();
-    long long timestamp = std::chrono::duration_cast<std::chrono::seconds>(currentTime).count();
-    con->_last_oper_time = timestamp;
+    // 更新最后操作时间，只用于60秒的空闲判断，粗粒度时钟足够
+    con->_last_oper_time = CoarseClock::NowSeconds();
 
     return con;
 }
@@ -227,7 +224,7 @@ int MySqlDao::RegUser(const std::string& name, const std::string& email, const s
         int result = -3; // 默认错误码，表示未获取到结果
         if (res->next()) {
             result = res->getInt("result");
-            std::cout << "用户注册结果: " << result << std::endl;
+            LOG_DEBUG << "用户注册结果: " << result;
         }
 
         // 无论是否获取到结果，都返回连接并返回结果
@@ -237,9 +234,9 @@ int MySqlDao::RegUser(const std::string& name, const std::string& email, const s
     catch (sql::SQLException& e)
     {
         // 先记录错误
-        std::cerr << "SQLException: " << e.what();
-        std::cerr << " (MySQL error code: " << e.getErrorCode();
-        std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+        LOG_ERROR << "SQLException: " << e.what()
+            << " (MySQL error code: " << e.getErrorCode()
+            << ", SQLState: " << e.getSQLState() << " )";
         // 确保连接被返回到池中
         try {
             if (con) {
@@ -247,33 +244,33 @@ int MySqlDao::RegUser(const std::string& name, const std::string& email, const s
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -1; // SQL异常错误码
     }
     catch (std::exception& e)
     {
-        std::cerr << "标准异常: " << e.what() << std::endl;
+        LOG_ERROR << "标准异常: " << e.what();
         try {
             if (con) {
                 pool_->returnConnection(std::move(con));
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -4; // 一般异常错误码
     }
     catch (...)
     {
-        std::cerr << "未知异常" << std::endl;
+        LOG_ERROR << "未知异常";
         try {
             if (con) {
                 pool_->returnConnection(std::move(con));
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -5; // 未知异常错误码
     }
@@ -283,7 +280,7 @@ int MySqlDao::CheckEmail(const std::string& name, const std::string& email)
 {
     auto con = pool_->getConnection();
     if (con == nullptr) {
-        std::cerr << "无法获取数据库连接" << std::endl;
+        LOG_ERROR << "无法获取数据库连接";
         return -2; // 数据库连接失败
     }
 
@@ -294,14 +291,14 @@ int MySqlDao::CheckEmail(const std::string& name, const std::string& email)
 
         // 如果没有结果，说明用户不存在
         if (!res->next()) {
-            std::cout << "用户 " << name << " 不存在" << std::endl;
+            LOG_INFO << "用户 " << name << " 不存在";
             pool_->returnConnection(std::move(con));
             return -6; // 用户不存在
         }
 
         // 检查邮箱是否匹配
         std::string db_email = res->getString("email");
-        std::cout << "数据库邮箱: " << db_email << ", 请求邮箱: " << email << std::endl;
+        LOG_DEBUG << "数据库邮箱: " << db_email << ", 请求邮箱: " << email;
         if (email != db_email) {
             pool_->returnConnection(std::move(con));
             return -7; // 邮箱不匹配
@@ -314,9 +311,9 @@ int MySqlDao::CheckEmail(const std::string& name, const std::string& email)
     catch (sql::SQLException& e)
     {
         // 记录错误
-        std::cerr << "SQLException: " << e.what();
-        std::cerr << " (MySQL error code: " << e.getErrorCode();
-        std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+        LOG_ERROR << "SQLException: " << e.what()
+            << " (MySQL error code: " << e.getErrorCode()
+            << ", SQLState: " << e.getSQLState() << " )";
 
         try {
             if (con) {
@@ -324,33 +321,33 @@ int MySqlDao::CheckEmail(const std::string& name, const std::string& email)
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -1; // SQL异常
     }
     catch (std::exception& e)
     {
-        std::cerr << "标准异常: " << e.what() << std::endl;
+        LOG_ERROR << "标准异常: " << e.what();
         try {
             if (con) {
                 pool_->returnConnection(std::move(con));
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -4; // 一般异常
     }
     catch (...)
     {
-        std::cerr << "未知异常" << std::endl;
+        LOG_ERROR << "未知异常";
         try {
             if (con) {
                 pool_->returnConnection(std::move(con));
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -5; // 未知异常
     }
@@ -360,7 +357,7 @@ int MySqlDao::UpdatePwd(const std::string& name, const std::string& newpwd)
 {
     auto con = pool_->getConnection();
     if (con == nullptr) {
-        std::cerr << "无法获取数据库连接" << std::endl;
+        LOG_ERROR << "无法获取数据库连接";
         return -2; // 数据库连接失败
     }
 
@@ -373,11 +370,11 @@ int MySqlDao::UpdatePwd(const std::string& name, const std::string& newpwd)
 
         // 执行更新
         int updateCount = pstmt->executeUpdate();
-        std::cout << "Updated rows: " << updateCount << std::endl;
+        LOG_DEBUG << "Updated rows: " << updateCount;
 
         // 检查是否有行被更新
         if (updateCount == 0) {
-            std::cout << "没有找到用户: " << name << std::endl;
+            LOG_INFO << "没有找到用户: " << name;
             pool_->returnConnection(std::move(con));
             return -6; // 用户不存在或者没有行被更新
         }
@@ -388,9 +385,9 @@ int MySqlDao::UpdatePwd(const std::string& name, const std::string& newpwd)
     catch (sql::SQLException& e)
     {
         // 记录错误
-        std::cerr << "SQLException: " << e.what();
-        std::cerr << " (MySQL error code: " << e.getErrorCode();
-        std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+        LOG_ERROR << "SQLException: " << e.what()
+            << " (MySQL error code: " << e.getErrorCode()
+            << ", SQLState: " << e.getSQLState() << " )";
 
         try {
             if (con) {
@@ -398,33 +395,33 @@ int MySqlDao::UpdatePwd(const std::string& name, const std::string& newpwd)
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -1; // SQL异常
     }
     catch (std::exception& e)
     {
-        std::cerr << "标准异常: " << e.what() << std::endl;
+        LOG_ERROR << "标准异常: " << e.what();
         try {
             if (con) {
                 pool_->returnConnection(std::move(con));
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -4; // 一般异常
     }
     catch (...)
     {
-        std::cerr << "未知异常" << std::endl;
+        LOG_ERROR << "未知异常";
         try {
             if (con) {
                 pool_->returnConnection(std::move(con));
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -5; // 未知异常
     }
@@ -434,7 +431,7 @@ int MySqlDao::CheckLogin(const std::string& email, const std::string& pwd, UserI
 {
     auto con = pool_->getConnection();
     if (con == nullptr) {
-        std::cerr << "无法获取数据库连接" << std::endl;
+        LOG_ERROR << "无法获取数据库连接";
         return -2; // 数据库连接失败
     }
 
@@ -445,14 +442,14 @@ int MySqlDao::CheckLogin(const std::string& email, const std::string& pwd, UserI
 
         // 如果没有结果，说明用户不存在
         if (!res->next()) {
-            std::cout << "用户 " << email << " 不存在" << std::endl;
+            LOG_INFO << "用户 " << email << " 不存在";
             pool_->returnConnection(std::move(con));
             return -1; // 用户不存在
         }
 
         // 检查密码是否匹配
         std::string db_pwd = res->getString("pwd");
-        std::cout << "数据库密码: " << db_pwd << ", 请求密码: " << pwd << std::endl;
+        LOG_DEBUG << "数据库密码: " << db_pwd << ", 请求密码: " << pwd;
         if (pwd != db_pwd) {
             pool_->returnConnection(std::move(con));
             return -3; // 密码不匹配
@@ -469,9 +466,9 @@ int MySqlDao::CheckLogin(const std::string& email, const std::string& pwd, UserI
     catch (sql::SQLException& e)
     {
         // 记录错误
-        std::cerr << "SQLException: " << e.what();
-        std::cerr << " (MySQL error code: " << e.getErrorCode();
-        std::cerr << ", SQLState: " << e.getSQLState() << " )" << std::endl;
+        LOG_ERROR << "SQLException: " << e.what()
+            << " (MySQL error code: " << e.getErrorCode()
+            << ", SQLState: " << e.getSQLState() << " )";
 
         try {
             if (con) {
@@ -479,33 +476,33 @@ int MySqlDao::CheckLogin(const std::string& email, const std::string& pwd, UserI
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -6; // SQL异常
     }
     catch (std::exception& e)
     {
-        std::cerr << "标准异常: " << e.what() << std::endl;
+        LOG_ERROR << "标准异常: " << e.what();
         try {
             if (con) {
                 pool_->returnConnection(std::move(con));
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -4; // 一般异常
     }
     catch (...)
     {
-        std::cerr << "未知异常" << std::endl;
+        LOG_ERROR << "未知异常";
         try {
             if (con) {
                 pool_->returnConnection(std::move(con));
             }
         }
         catch (...) {
-            std::cerr << "返回连接到池中时发生异常" << std::endl;
+            LOG_ERROR << "返回连接到池中时发生异常";
         }
         return -5; // 未知异常
     }
@@ -0,0 +1,55 @@
+#include "PhiAccrualDetector.h"
+#include <algorithm>
+#include <cmath>
+
+PhiAccrualDetector::PhiAccrualDetector(std::size_t windowSize, double minStdDevMs, double acceptablePauseMs)
+    : _window_size(windowSize == 0 ? 1 : windowSize), _next(0), _sum(0), _sum_sq(0),
+    _min_std_dev(minStdDevMs), _acceptable_pause(std::max(0.0, acceptablePauseMs)), _last_ms(-1)
+{
+    _intervals.reserve(_window_size);
+}
+
+void PhiAccrualDetector::Heartbeat(int64_t nowMs)
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (_last_ms >= 0) {
+        double interval = static_cast<double>(nowMs - _last_ms);
+        if (_intervals.size() < _window_size) {
+            _intervals.push_back(interval);
+        }
+        else {
+            // 窗口已满，替换最旧的样本
+            double old = _intervals[_next];
+            _sum -= old;
+            _sum_sq -= old * old;
+            _intervals[_next] = interval;
+            _next = (_next + 1) % _window_size;
+        }
+        _sum += interval;
+        _sum_sq += interval * interval;
+    }
+    _last_ms = nowMs;
+}
+
+double PhiAccrualDetector::Phi(int64_t nowMs) const
+{
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (_intervals.empty()) {
+        return 0.0;
+    }
+
+    double n = static_cast<double>(_intervals.size());
+    double mean = _sum / n;
+    double variance = std::max(0.0, _sum_sq / n - mean * mean);
+    mean += _acceptable_pause;
+    double stdDev = std::max(std::sqrt(variance), _min_std_dev);
+
+    // 正态分布CDF的logistic近似，避免在尾部直接计算 1 - F 造成的精度损失
+    double elapsed = static_cast<double>(nowMs - _last_ms);
+    double y = (elapsed - mean) / stdDev;
+    double e = std::exp(-y * (1.5976 + 0.070566 * y * y));
+    if (elapsed > mean) {
+        return -std::log10(e / (1.0 + e));
+    }
+    return -std::log10(1.0 - 1.0 / (1.0 + e));
+}
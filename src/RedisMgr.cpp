@@ -1,4 +1,5 @@
 #include "RedisMgr.h"
+#include "AsyncLogger.h"
 
 RedisMgr::RedisMgr()
 {
@@ -23,14 +24,14 @@ bool RedisMgr::Get(const std::string& key, std::string& value)
 
     auto reply = (redisReply*)redisCommand(connect, "GET %s", key.c_str());
     if (reply == NULL) {
-        std::cout << "[ GET  " << key << " ] failed" << std::endl;
+        LOG_WARN << "[ GET  " << key << " ] failed";
         freeReplyObject(reply);
         _con_pool->returnConnection(connect);
         return false;
     }
 
     if (reply->type != REDIS_REPLY_STRING) {
-        std::cout << "[ GET  " << key << " ] failed" << std::endl;
+        LOG_WARN << "[ GET  " << key << " ] failed";
         freeReplyObject(reply);
         _con_pool->returnConnection(connect);
         return false;
@@ -39,7 +40,7 @@ bool RedisMgr::Get(const std::string& key, std::string& value)
     value = reply->str;
     freeReplyObject(reply);
 
-    std::cout << "Succeed to execute command [ GET " << key << "  ]" << std::endl;
+    LOG_DEBUG << "Succeed to execute command [ GET " << key << "  ]";
     _con_pool->returnConnection(connect);
     return true;
 }
@@ -55,7 +56,7 @@ bool RedisMgr::Set(const std::string& key, const std::string& value) {
     //如果返回NULL则说明执行失败
     if (NULL == reply)
     {
-        std::cout << "Executing command [ SET " << key << "  " << value << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ SET " << key << "  " << value << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
@@ -63,14 +64,80 @@ bool RedisMgr::Set(const std::string& key, const std::string& value) {
     //如果执行失败则释放连接
     if (!(reply->type == REDIS_REPLY_STATUS && (strcmp(reply->str, "OK") == 0 || strcmp(reply->str, "ok") == 0)))
     {
-        std::cout << "Executing command [ SET " << key << "  " << value << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ SET " << key << "  " << value << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
 
     //执行成功 释放redisCommand执行后返回的redisReply所占用的内存
     freeReplyObject(reply);
-    std::cout << "Executing command [ SET " << key << "  " << value << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ SET " << key << "  " << value << " ] success ! ";
+    return true;
+}
+
+bool RedisMgr::SetBatch(const std::vector<std::pair<std::string, std::string>>& kvs, int ttlSeconds,
+    std::vector<std::size_t>* failedIndexes)
+{
+    if (kvs.empty()) {
+        return true;
+    }
+
+    auto connect = _con_pool->getConnection();
+    if (connect == nullptr) {
+        if (failedIndexes) {
+            for (std::size_t i = 0; i < kvs.size(); ++i) {
+                failedIndexes->push_back(i);
+            }
+        }
+        return false;
+    }
+
+    // 先把所有命令写进输出缓冲，再依次读回复，整批只需要一次网络往返
+    for (const auto& kv : kvs) {
+        if (ttlSeconds > 0) {
+            redisAppendCommand(connect, "SET %s %s EX %d", kv.first.c_str(), kv.second.c_str(), ttlSeconds);
+        }
+        else {
+            redisAppendCommand(connect, "SET %s %s", kv.first.c_str(), kv.second.c_str());
+        }
+    }
+
+    std::size_t failed = 0;
+    bool broken = false;
+    for (std::size_t i = 0; i < kvs.size(); ++i) {
+        redisReply* reply = nullptr;
+        if (redisGetReply(connect, (void**)&reply) != REDIS_OK || reply == nullptr) {
+            // 连接已断开，剩余的回复都拿不到了
+            failed += kvs.size() - i;
+            broken = true;
+            if (failedIndexes) {
+                for (std::size_t j = i; j < kvs.size(); ++j) {
+                    failedIndexes->push_back(j);
+                }
+            }
+            break;
+        }
+        if (reply->type == REDIS_REPLY_ERROR) {
+            ++failed;
+            if (failedIndexes) {
+                failedIndexes->push_back(i);
+            }
+        }
+        freeReplyObject(reply);
+    }
+    // 读回复失败后连接上可能还有未读的回复，放回池里会让下一个命令读到错位的结果
+    if (broken) {
+        _con_pool->discardConnection(connect);
+    }
+    else {
+        _con_pool->returnConnection(connect);
+    }
+
+    if (failed > 0) {
+        LOG_WARN << "Executing pipelined [ SET x" << kvs.size() << " ] failure ! failed: " << failed;
+        return false;
+    }
+    LOG_DEBUG << "Executing pipelined [ SET x" << kvs.size() << " ] success ! ";
     return true;
 }
 
@@ -83,7 +150,7 @@ bool RedisMgr::Auth(const std::string& password)
 
     auto reply = (redisReply*)redisCommand(connect, "AUTH %s", password.c_str());
     if (reply->type == REDIS_REPLY_ERROR) {
-        std::cout << "认证失败" << std::endl;
+        LOG_WARN << "认证失败";
         //执行成功 释放redisCommand执行后返回的redisReply所占用的内存
         freeReplyObject(reply);
         return false;
@@ -91,7 +158,7 @@ bool RedisMgr::Auth(const std::string& password)
     else {
         //执行成功 释放redisCommand执行后返回的redisReply所占用的内存
         freeReplyObject(reply);
-        std::cout << "认证成功" << std::endl;
+        LOG_INFO << "认证成功";
         return true;
     }
 }
@@ -106,18 +173,18 @@ bool RedisMgr::LPush(const std::string& key, const std::string& value)
     auto reply = (redisReply*)redisCommand(connect, "LPUSH %s %s", key.c_str(), value.c_str());
     if (NULL == reply)
     {
-        std::cout << "Executing command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ LPUSH " << key << "  " << value << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
 
     if (reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
-        std::cout << "Executing command [ LPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ LPUSH " << key << "  " << value << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
 
-    std::cout << "Executing command [ LPUSH " << key << "  " << value << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ LPUSH " << key << "  " << value << " ] success ! ";
     freeReplyObject(reply);
     return true;
 }
@@ -130,12 +197,12 @@ bool RedisMgr::LPop(const std::string& key, std::string& value) {
 
     auto reply = (redisReply*)redisCommand(connect, "LPOP %s ", key.c_str());
     if (reply == nullptr || reply->type == REDIS_REPLY_NIL) {
-        std::cout << "Executing command [ LPOP " << key << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ LPOP " << key << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
     value = reply->str;
-    std::cout << "Executing command [ LPOP " << key << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ LPOP " << key << " ] success ! ";
     freeReplyObject(reply);
     return true;
 }
@@ -149,18 +216,18 @@ bool RedisMgr::RPush(const std::string& key, const std::string& value) {
     auto reply = (redisReply*)redisCommand(connect, "RPUSH %s %s", key.c_str(), value.c_str());
     if (NULL == reply)
     {
-        std::cout << "Executing command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ RPUSH " << key << "  " << value << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
 
     if (reply->type != REDIS_REPLY_INTEGER || reply->integer <= 0) {
-        std::cout << "Executing command [ RPUSH " << key << "  " << value << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ RPUSH " << key << "  " << value << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
 
-    std::cout << "Executing command [ RPUSH " << key << "  " << value << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ RPUSH " << key << "  " << value << " ] success ! ";
     freeReplyObject(reply);
     return true;
 }
@@ -173,12 +240,12 @@ bool RedisMgr::RPop(const std::string& key, std::string& value) {
 
     auto reply = (redisReply*)redisCommand(connect, "RPOP %s ", key.c_str());
     if (reply == nullptr || reply->type == REDIS_REPLY_NIL) {
-        std::cout << "Executing command [ RPOP " << key << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ RPOP " << key << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
     value = reply->str;
-    std::cout << "Executing command [ RPOP " << key << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ RPOP " << key << " ] success ! ";
     freeReplyObject(reply);
     return true;
 }
@@ -191,11 +258,11 @@ bool RedisMgr::HSet(const std::string& key, const std::string& hkey, const std::
 
     auto reply = (redisReply*)redisCommand(connect, "HSET %s %s %s", key.c_str(), hkey.c_str(), value.c_str());
     if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
-        std::cout << "Executing command [ HSet " << key << "  " << hkey << "  " << value << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ HSet " << key << "  " << hkey << "  " << value << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
-    std::cout << "Executing command [ HSet " << key << "  " << hkey << "  " << value << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ HSet " << key << "  " << hkey << "  " << value << " ] success ! ";
     freeReplyObject(reply);
     return true;
 }
@@ -220,11 +287,11 @@ bool RedisMgr::HSet(const char* key, const char* hkey, const char* hvalue, size_
     argvlen[3] = hvaluelen;
     auto reply = (redisReply*)redisCommandArgv(connect, 4, argv, argvlen);
     if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
-        std::cout << "Executing command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
-    std::cout << "Executing command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ HSet " << key << "  " << hkey << "  " << hvalue << " ] success ! ";
     freeReplyObject(reply);
     return true;
 }
@@ -247,13 +314,13 @@ std::string RedisMgr::HGet(const std::string& key, const std::string& hkey)
     auto reply = (redisReply*)redisCommandArgv(connect, 3, argv, argvlen);
     if (reply == nullptr || reply->type == REDIS_REPLY_NIL) {
         freeReplyObject(reply);
-        std::cout << "Executing command [ HGet " << key << " " << hkey << "  ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ HGet " << key << " " << hkey << "  ] failure ! ";
         return "";
     }
 
     std::string value = reply->str;
     freeReplyObject(reply);
-    std::cout << "Executing command [ HGet " << key << " " << hkey << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ HGet " << key << " " << hkey << " ] success ! ";
     return value;
 }
 
@@ -266,11 +333,11 @@ bool RedisMgr::Del(const std::string& key)
 
     auto reply = (redisReply*)redisCommand(connect, "DEL %s", key.c_str());
     if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER) {
-        std::cout << "Executing command [ Del " << key << " ] failure ! " << std::endl;
+        LOG_WARN << "Executing command [ Del " << key << " ] failure ! ";
         freeReplyObject(reply);
         return false;
     }
-    std::cout << "Executing command [ Del " << key << " ] success ! " << std::endl;
+    LOG_DEBUG << "Executing command [ Del " << key << " ] success ! ";
     freeReplyObject(reply);
     return true;
 }
@@ -284,11 +351,11 @@ bool RedisMgr::ExistsKey(const std::string& key)
 
     auto reply = (redisReply*)redisCommand(connect, "exists %s", key.c_str());
     if (reply == nullptr || reply->type != REDIS_REPLY_INTEGER || reply->integer == 0) {
-        std::cout << "Not Found [ Key " << key << " ]  ! " << std::endl;
+        LOG_WARN << "Not Found [ Key " << key << " ]  ! ";
         freeReplyObject(reply);
         return false;
     }
-    std::cout << " Found [ Key " << key << " ] exists ! " << std::endl;
+    LOG_DEBUG << " Found [ Key " << key << " ] exists ! ";
     freeReplyObject(reply);
     return true;
 }
@@ -372,6 +439,21 @@ void RedisConPool::returnConnection(redisContext* context) {
     cond_.notify_one();
 }
 
+void RedisConPool::discardConnection(redisContext* context) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (context) {
+        redisFree(context);
+    }
+    if (b_stop_) {
+        return;
+    }
+    context = createConnection();
+    if (context) {
+        connections_.push(context);
+    }
+    cond_.notify_one();
+}
+
 void RedisConPool::Close() {
     b_stop_ = true;
     cond_.notify_all();
@@ -381,14 +463,14 @@ redisContext* RedisConPool::createConnection() {
     redisContext* context = redisConnect(host_, port_);
     if (context == nullptr || context->err != 0) {
         if (context != nullptr) {
-            std::cout << "连接失败: " << context->errstr << std::endl;
+            LOG_WARN << "连接失败: " << context->errstr;
             redisFree(context);
         }
         return nullptr;
     }
     auto reply = (redisReply*)redisCommand(context, "AUTH %s", password_.c_str());
     if (reply == nullptr || reply->type == REDIS_REPLY_ERROR) {
-        std::cout << "认证失败: " << (reply ? reply->str : "unknown error") << std::endl;
+        LOG_WARN << "认证失败: " << (reply ? reply->str : "unknown error");
         if (reply) {
             freeReplyObject(reply);
         }
@@ -397,7 +479,7 @@ redisContext* RedisConPool::createConnection() {
     }
 
     freeReplyObject(reply);
-    std::cout << "认证成功" << std::endl;
+    LOG_INFO << "认证成功";
     return context;
 }
 
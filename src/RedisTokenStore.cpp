@@ -0,0 +1,187 @@
+#include "RedisTokenStore.h"
+#include "AsyncLogger.h"
+#include "RedisMgr.h"
+#include "const.h"
+
+namespace {
+// 写缓冲积累到这个数量时不再等待，立即刷出
+constexpr std::size_t kMaxBatch = 512;
+// 一条令牌最多尝试写入的次数，超过后丢弃
+constexpr uint32_t kMaxAttempts = 3;
+}
+
+RedisTokenStore::RedisTokenStore(uint32_t ttlSeconds, std::chrono::microseconds flushInterval)
+    : _ttl_seconds(ttlSeconds), _flush_interval(flushInterval), _b_stop(false)
+{
+    _pending.reserve(kMaxBatch);
+    _flush_thread = std::thread([this]() { flushLoop(); });
+}
+
+RedisTokenStore::~RedisTokenStore()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _b_stop = true;
+    }
+    _cond.notify_all();
+    if (_flush_thread.joinable()) {
+        _flush_thread.join();
+    }
+}
+
+bool RedisTokenStore::Insert(int uid, const TokenBytes& token)
+{
+    bool notify = false;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.push_back(PendingToken{ uid, token, 0 });
+        // 只在缓冲由空变非空或攒满一批时唤醒刷新线程
+        notify = _pending.size() == 1 || _pending.size() >= kMaxBatch;
+    }
+    if (notify) {
+        _cond.notify_one();
+    }
+    return false;
+}
+
+void RedisTokenStore::InsertBatch(const std::vector<std::pair<int, TokenBytes>>& tokens)
+{
+    if (tokens.empty()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (const auto& item : tokens) {
+            _pending.push_back(PendingToken{ item.first, item.second, 0 });
+        }
+    }
+    _cond.notify_one();
+}
+
+int RedisTokenStore::Verify(int uid, const TokenBytes& token)
+{
+    TokenBytes stored;
+    if (!findPending(uid, stored)) {
+        std::string text;
+        if (!RedisMgr::GetInstance()->Get(USERTOKENPREFIX + std::to_string(uid), text)) {
+            return ErrorCodes::UidInvalid;
+        }
+        if (!TokenGenerator::Parse(text, stored)) {
+            return ErrorCodes::TokenInvalid;
+        }
+    }
+    return TokenGenerator::Equal(stored, token) ? ErrorCodes::SUCCESS : ErrorCodes::TokenInvalid;
+}
+
+std::size_t RedisTokenStore::Size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _pending.size() + _inflight.size();
+}
+
+void RedisTokenStore::Clear()
+{
+    std::vector<PendingToken> batch;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        batch.swap(_pending);
+    }
+    std::vector<PendingToken> failed;
+    flush(batch, failed);
+    if (!failed.empty()) {
+        LOG_ERROR << "错误：清空写缓冲时有令牌未能写入Redis，数量: " << failed.size();
+    }
+}
+
+bool RedisTokenStore::findPending(int uid, TokenBytes& token) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    // 从后往前找，同一uid以最新写入的为准
+    for (auto iter = _pending.rbegin(); iter != _pending.rend(); ++iter) {
+        if (iter->uid == uid) {
+            token = iter->token;
+            return true;
+        }
+    }
+    for (auto iter = _inflight.rbegin(); iter != _inflight.rend(); ++iter) {
+        if (iter->uid == uid) {
+            token = iter->token;
+            return true;
+        }
+    }
+    return false;
+}
+
+void RedisTokenStore::flushLoop()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        // 没有待写入的令牌时一直睡眠，不做空轮询
+        _cond.wait(lock, [this] { return _b_stop || !_pending.empty(); });
+        if (_pending.empty() && _b_stop) {
+            break;
+        }
+        // 第一条写入到达后再等一个刷新间隔，让并发的写入合并进同一批
+        _cond.wait_for(lock, _flush_interval, [this] { return _b_stop || _pending.size() >= kMaxBatch; });
+
+        _inflight.swap(_pending);
+        lock.unlock();
+        std::vector<PendingToken> failed;
+        flush(_inflight, failed);
+        lock.lock();
+        _inflight.clear();
+        requeueLocked(failed);
+        if (!failed.empty() && !_b_stop) {
+            // Redis暂时不可用时不要立刻重试，至少等一个刷新间隔
+            _cond.wait_for(lock, _flush_interval, [this] { return _b_stop; });
+        }
+    }
+}
+
+void RedisTokenStore::requeueLocked(std::vector<PendingToken>& failed)
+{
+    if (failed.empty()) {
+        return;
+    }
+    std::size_t dropped = 0;
+    std::vector<PendingToken> retry;
+    retry.reserve(failed.size() + _pending.size());
+    for (auto& item : failed) {
+        if (++item.attempts >= kMaxAttempts) {
+            ++dropped;
+            continue;
+        }
+        retry.push_back(std::move(item));
+    }
+    if (dropped > 0) {
+        LOG_ERROR << "错误：令牌写入Redis连续失败" << kMaxAttempts << "次，已丢弃，数量: " << dropped;
+    }
+    if (retry.empty()) {
+        return;
+    }
+    // 放在新令牌前面：同一uid后签发的令牌写在后面，Redis里留下的仍是最新的
+    for (auto& item : _pending) {
+        retry.push_back(std::move(item));
+    }
+    _pending.swap(retry);
+}
+
+void RedisTokenStore::flush(const std::vector<PendingToken>& batch, std::vector<PendingToken>& failed)
+{
+    if (batch.empty()) {
+        return;
+    }
+
+    std::vector<std::pair<std::string, std::string>> kvs;
+    kvs.reserve(batch.size());
+    for (const auto& item : batch) {
+        kvs.emplace_back(USERTOKENPREFIX + std::to_string(item.uid), TokenGenerator::ToString(item.token));
+    }
+    std::vector<std::size_t> failedIndexes;
+    if (RedisMgr::GetInstance()->SetBatch(kvs, static_cast<int>(_ttl_seconds), &failedIndexes)) {
+        return;
+    }
+    for (auto index : failedIndexes) {
+        failed.push_back(batch[index]);
+    }
+}
@@ -0,0 +1,140 @@
+#include "ReplicationClient.h"
+#include <chrono>
+#include <cstring>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "LogFormat.h"
+
+ReplicationClient::ReplicationClient(ChatServerRegistry& servers, TokenStore* tokens,
+    const std::string& primary, const std::string& name, const std::string& secret)
+    : _servers(servers), _tokens(tokens), _primary(primary), _name(name), _secret(secret),
+    _last_sequence(0), _context(nullptr), _b_stop(false)
+{
+    _thread = std::thread([this]() { run(); });
+}
+
+ReplicationClient::~ReplicationClient()
+{
+    Stop();
+}
+
+void ReplicationClient::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _b_stop = true;
+        if (_context) {
+            _context->TryCancel();
+        }
+    }
+    _stop_cond.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void ReplicationClient::run()
+{
+    auto channel = grpc::CreateChannel(_primary, grpc::InsecureChannelCredentials());
+    auto stub = message::StatusService::NewStub(channel);
+    message::ReplicateReq request;
+    request.set_replica_name(_name);
+    request.set_secret(_secret);
+
+    while (true) {
+        grpc::ClientContext context;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_b_stop) {
+                break;
+            }
+            _context = &context;
+        }
+
+        auto reader = stub->Replicate(&context, request);
+        message::ReplicationBatch batch;
+        std::size_t received = 0;
+        while (reader->Read(&batch)) {
+            apply(batch);
+            ++received;
+        }
+        auto status = reader->Finish();
+
+        bool stop;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _context = nullptr;
+            stop = _b_stop;
+        }
+        if (stop) {
+            break;
+        }
+        LOGF_WARN("与主机 {} 的复制流断开（{}），已接收 {} 个批次，1秒后重连",
+            _primary, status.error_message(), received);
+        std::unique_lock<std::mutex> lock(_mutex);
+        _stop_cond.wait_for(lock, std::chrono::seconds(1), [this] { return _b_stop; });
+    }
+    LOGF_INFO("复制线程已退出");
+}
+
+void ReplicationClient::apply(const message::ReplicationBatch& batch)
+{
+    if (batch.reset()) {
+        // 全量开始：丢弃主机上已经不存在的服务器和全部令牌，令牌随后的批次会补齐
+        std::unordered_set<std::string> names;
+        for (const auto& record : batch.servers()) {
+            names.insert(record.name());
+        }
+        auto snapshot = _servers.Snapshot();
+        for (const auto& server : snapshot->servers) {
+            if (names.count(server->name) == 0) {
+                _servers.Remove(server->name);
+            }
+        }
+        if (_tokens) {
+            _tokens->Clear();
+        }
+        LOGF_INFO("开始从主机 {} 全量同步，服务器 {} 台", _primary, batch.servers_size());
+    }
+    else if (batch.sequence() != 0) {
+        _last_sequence.store(batch.sequence(), std::memory_order_relaxed);
+    }
+
+    for (const auto& record : batch.servers()) {
+        if (record.removed()) {
+            _servers.Remove(record.name());
+            continue;
+        }
+        auto server = _servers.Find(record.name());
+        if (server && (server->host != record.host() || server->port != record.port()
+            || server->weight != record.weight())) {
+            // 同名服务器换了地址或权重，按主机的重新注册
+            _servers.Remove(record.name());
+            server.reset();
+        }
+        if (!server) {
+            _servers.Add(record.name(), record.host(), record.port(), record.weight());
+            server = _servers.Find(record.name());
+            if (!server) {
+                continue;
+            }
+        }
+        // 主机发来的是绝对值，重复应用结果相同
+        _servers.SetConnections(server, record.con_count());
+    }
+
+    if (_tokens && batch.tokens_size() > 0) {
+        std::vector<std::pair<int, TokenBytes>> tokens;
+        tokens.reserve(batch.tokens_size());
+        for (const auto& record : batch.tokens()) {
+            TokenBytes token;
+            if (record.token().size() != sizeof(token.data)) {
+                continue;
+            }
+            std::memcpy(token.data, record.token().data(), sizeof(token.data));
+            tokens.emplace_back(record.uid(), token);
+        }
+        _tokens->InsertBatch(tokens);
+    }
+}
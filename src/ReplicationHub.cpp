@@ -0,0 +1,270 @@
+#include "ReplicationHub.h"
+#include <algorithm>
+#include <openssl/crypto.h>
+#include "LogFormat.h"
+
+namespace {
+// 全量同步时每个批次携带的令牌数
+constexpr std::size_t kFullSyncChunk = 4096;
+
+// 从gRPC的peer字符串（ipv4:10.0.0.2:5123、ipv6:[::1]:5123）中取出IP
+std::string peerAddress(const std::string& peer)
+{
+    auto first = peer.find(':');
+    auto last = peer.rfind(':');
+    if (first == std::string::npos || last <= first) {
+        return peer;
+    }
+    auto address = peer.substr(first + 1, last - first - 1);
+    if (address.size() >= 2 && address.front() == '[' && address.back() == ']') {
+        address = address.substr(1, address.size() - 2);
+    }
+    return address;
+}
+}
+
+ReplicationHub::ReplicationHub(ChatServerRegistry& servers, TokenStore* tokens,
+    std::chrono::milliseconds flushInterval, std::size_t queueLimit,
+    const std::string& secret, const std::vector<std::string>& allowedPeers)
+    : _servers(servers), _tokens(tokens), _flush_interval(flushInterval),
+    _queue_limit(queueLimit == 0 ? 1 : queueLimit), _secret(secret), _allowed_peers(allowedPeers),
+    _has_subscribers(false), _sequence(0), _b_stop(false)
+{
+    _flush_thread = std::thread([this]() { flushLoop(); });
+}
+
+ReplicationHub::~ReplicationHub()
+{
+    Stop();
+}
+
+void ReplicationHub::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_b_stop) {
+            return;
+        }
+        _b_stop = true;
+    }
+    _flush_cond.notify_all();
+    _subscriber_cond.notify_all();
+    if (_flush_thread.joinable()) {
+        _flush_thread.join();
+    }
+}
+
+std::size_t ReplicationHub::SubscriberCount() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _subscribers.size();
+}
+
+void ReplicationHub::RecordToken(int uid, const TokenBytes& token)
+{
+    if (!_tokens || !_has_subscribers.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.emplace_back(uid, token);
+}
+
+void ReplicationHub::RecordTokens(const std::vector<std::pair<int, TokenBytes>>& tokens)
+{
+    if (!_tokens || tokens.empty() || !_has_subscribers.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    _pending.insert(_pending.end(), tokens.begin(), tokens.end());
+}
+
+bool ReplicationHub::sendFullSync(grpc::ServerWriter<message::ReplicationBatch>* writer)
+{
+    // 第一个批次带reset标记和全部服务器，备机据此丢弃旧状态
+    message::ReplicationBatch batch;
+    batch.set_reset(true);
+    auto snapshot = _servers.Snapshot();
+    for (const auto& server : snapshot->servers) {
+        auto* record = batch.add_servers();
+        record->set_name(server->name);
+        record->set_host(server->host);
+        record->set_port(server->port);
+        record->set_weight(server->weight);
+        record->set_con_count(server->con_count.load(std::memory_order_relaxed));
+    }
+
+    bool ok = true;
+    if (_tokens) {
+        _tokens->ForEachToken([&batch, &ok, writer](int uid, const TokenBytes& token) {
+            if (!ok) {
+                return;
+            }
+            auto* record = batch.add_tokens();
+            record->set_uid(uid);
+            record->set_token(token.data, sizeof(token.data));
+            if (static_cast<std::size_t>(batch.tokens_size()) >= kFullSyncChunk) {
+                ok = writer->Write(batch);
+                batch.Clear();
+            }
+            });
+    }
+    return ok && writer->Write(batch);
+}
+
+bool ReplicationHub::authorize(grpc::ServerContext* context, const message::ReplicateReq* request) const
+{
+    // 密钥按常量时间比较，耗时不随第几个字节不同而变化
+    const auto& secret = request->secret();
+    if (_secret.empty() || secret.size() != _secret.size()
+        || CRYPTO_memcmp(secret.data(), _secret.data(), _secret.size()) != 0) {
+        return false;
+    }
+    if (_allowed_peers.empty()) {
+        return true;
+    }
+    auto address = peerAddress(context->peer());
+    return std::find(_allowed_peers.begin(), _allowed_peers.end(), address) != _allowed_peers.end();
+}
+
+grpc::Status ReplicationHub::Serve(grpc::ServerContext* context, const message::ReplicateReq* request,
+    grpc::ServerWriter<message::ReplicationBatch>* writer)
+{
+    if (!authorize(context, request)) {
+        LOGF_WARN("拒绝来自 {} 的复制请求（备机名: {}），密钥不对或地址不在ReplicaAllowlist中",
+            context->peer(), request->replica_name());
+        return grpc::Status(grpc::StatusCode::PERMISSION_DENIED, "replication not authorized");
+    }
+
+    // 先登记再做全量，全量期间产生的变化会进入队列，之后重复应用一次也没有问题
+    auto subscriber = std::make_shared<Subscriber>();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_b_stop) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "replication stopped");
+        }
+        _subscribers.push_back(subscriber);
+        _has_subscribers.store(true, std::memory_order_relaxed);
+    }
+    LOGF_INFO("备机 {} 开始复制，当前备机数: {}", request->replica_name(), SubscriberCount());
+
+    bool ok = sendFullSync(writer);
+    while (ok) {
+        std::shared_ptr<const message::ReplicationBatch> batch;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            // 定期醒来检查备机是否已断开
+            _subscriber_cond.wait_for(lock, std::chrono::milliseconds(500), [this, &subscriber] {
+                return _b_stop || subscriber->broken || !subscriber->queue.empty();
+                });
+            if (_b_stop || subscriber->broken) {
+                break;
+            }
+            if (subscriber->queue.empty()) {
+                ok = !context->IsCancelled();
+                continue;
+            }
+            batch = std::move(subscriber->queue.front());
+            subscriber->queue.pop_front();
+        }
+        ok = writer->Write(*batch);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        for (auto iter = _subscribers.begin(); iter != _subscribers.end(); ++iter) {
+            if (*iter == subscriber) {
+                _subscribers.erase(iter);
+                break;
+            }
+        }
+        _has_subscribers.store(!_subscribers.empty(), std::memory_order_relaxed);
+        if (_subscribers.empty()) {
+            _pending.clear();
+        }
+    }
+    if (subscriber->broken) {
+        LOGF_WARN("备机 {} 积压过多，断开复制流，重连后需重新全量同步", request->replica_name());
+    }
+    else {
+        LOGF_INFO("备机 {} 停止复制", request->replica_name());
+    }
+    return subscriber->broken ? grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED, "replica lagging")
+        : grpc::Status::OK;
+}
+
+void ReplicationHub::appendServerChanges(message::ReplicationBatch& batch)
+{
+    auto snapshot = _servers.Snapshot();
+    for (const auto& server : snapshot->servers) {
+        int count = server->con_count.load(std::memory_order_relaxed);
+        auto iter = _sent.find(server->name);
+        if (iter != _sent.end() && iter->second.host == server->host && iter->second.port == server->port
+            && iter->second.weight == server->weight && iter->second.con_count == count) {
+            continue;
+        }
+        auto* record = batch.add_servers();
+        record->set_name(server->name);
+        record->set_host(server->host);
+        record->set_port(server->port);
+        record->set_weight(server->weight);
+        record->set_con_count(count);
+        _sent[server->name] = SentServer{ server->host, server->port, server->weight, count };
+    }
+    for (auto iter = _sent.begin(); iter != _sent.end();) {
+        if (snapshot->by_name.count(iter->first) == 0) {
+            auto* record = batch.add_servers();
+            record->set_name(iter->first);
+            record->set_removed(true);
+            iter = _sent.erase(iter);
+        }
+        else {
+            ++iter;
+        }
+    }
+}
+
+void ReplicationHub::flushLoop()
+{
+    std::vector<std::pair<int, TokenBytes>> tokens;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _flush_cond.wait_for(lock, _flush_interval, [this] { return _b_stop; });
+        if (_b_stop) {
+            break;
+        }
+        if (_subscribers.empty()) {
+            continue;
+        }
+        tokens.clear();
+        tokens.swap(_pending);
+        lock.unlock();
+
+        auto batch = std::make_shared<message::ReplicationBatch>();
+        for (const auto& item : tokens) {
+            auto* record = batch->add_tokens();
+            record->set_uid(item.first);
+            record->set_token(item.second.data, sizeof(item.second.data));
+        }
+        appendServerChanges(*batch);
+
+        lock.lock();
+        if (batch->tokens_size() == 0 && batch->servers_size() == 0) {
+            continue;
+        }
+        batch->set_sequence(++_sequence);
+        std::shared_ptr<const message::ReplicationBatch> shared = std::move(batch);
+        for (const auto& subscriber : _subscribers) {
+            if (subscriber->broken) {
+                continue;
+            }
+            if (subscriber->queue.size() >= _queue_limit) {
+                // 备机跟不上，断开它，重连后会重新全量同步
+                subscriber->broken = true;
+                subscriber->queue.clear();
+                continue;
+            }
+            subscriber->queue.push_back(shared);
+        }
+        _subscriber_cond.notify_all();
+    }
+}
@@ -0,0 +1,466 @@
+#include "ShardedTokenStore.h"
+#include "const.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+// 过时定时项超过有效令牌数加上这个余量时清理，避免令牌很少时频繁扫描时间轮
+constexpr std::size_t kStaleTimerSlack = 256;
+}
+
+ShardedTokenStore::ShardedTokenStore(std::size_t shardCount, uint64_t ttlTicks, std::size_t memoryBudget)
+    : _ttl_ticks(ttlTicks), _max_per_shard(0)
+{
+    // 向上取整到2的幂，至少1个分片
+    std::size_t count = 1;
+    while (count < shardCount) {
+        count <<= 1;
+    }
+    _shards.reset(new Shard[count]);
+    _mask = count - 1;
+    if (memoryBudget > 0) {
+        // 有TTL时每个令牌按两个定时项预留：一个有效的，加上清理前最多同等数量的过时项
+        std::size_t timerBytes = ttlTicks > 0 ? 2 * TimingWheel<Expiry>::NodeBytes() : 0;
+        _max_per_shard = FlatHashMap<int, TokenEntry>::MaxSizeForMemory(memoryBudget / count, timerBytes);
+    }
+}
+
+ShardedTokenStore::Shard& ShardedTokenStore::shardFor(int uid) const
+{
+    // uid通常是连续自增的，先用乘法散列打散高位，再取低位作为分片下标
+    uint64_t h = static_cast<uint32_t>(uid) * 0x9E3779B97F4A7C15ull;
+    return _shards[(h >> 32) & _mask];
+}
+
+void ShardedTokenStore::makeRoom(Shard& shard, int uid)
+{
+    if (_max_per_shard == 0 || shard.tokens.Size() < _max_per_shard || shard.tokens.Find(uid)) {
+        return;
+    }
+    evictOne(shard);
+}
+
+bool ShardedTokenStore::evictOne(Shard& shard)
+{
+    // 时钟指针扫过的令牌：已过期的直接淘汰，访问标记为1的清零放过，为0的淘汰
+    bool evicted = shard.tokens.SweepErase(shard.clock_hand, [](const int&, TokenEntry& entry) {
+        if (entry.expired || !entry.referenced) {
+            return false;
+        }
+        entry.referenced = false;
+        return true;
+        });
+    if (evicted) {
+        ++shard.evictions;
+        if (_ttl_ticks > 0) {
+            ++shard.stale_timers;
+        }
+    }
+    return evicted;
+}
+
+void ShardedTokenStore::compactTimers(Shard& shard)
+{
+    if (shard.stale_timers <= shard.tokens.Size() + kStaleTimerSlack) {
+        return;
+    }
+    shard.wheel.RemoveIf([&shard](const Expiry& expiry) {
+        auto* entry = shard.tokens.Find(expiry.uid);
+        return !entry || entry->generation != expiry.generation;
+        });
+    shard.stale_timers = 0;
+}
+
+void ShardedTokenStore::insertLocked(Shard& shard, int uid, const TokenBytes& token, bool& existed)
+{
+    makeRoom(shard, uid);
+    auto generation = ++shard.next_generation;
+    existed = !shard.tokens.InsertOrAssign(uid, TokenEntry{ token, generation, false, true });
+    if (_ttl_ticks > 0) {
+        // 旧令牌的定时项不用立即删除，到期时发现代数不匹配会直接忽略；
+        // 同一uid反复登录时这类定时项会不断累积，由compactTimers限制数量
+        shard.wheel.Add(_ttl_ticks, Expiry{ uid, generation });
+        if (existed) {
+            ++shard.stale_timers;
+        }
+        compactTimers(shard);
+    }
+}
+
+bool ShardedTokenStore::Insert(int uid, const TokenBytes& token)
+{
+    auto& shard = shardFor(uid);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    bool existed = false;
+    insertLocked(shard, uid, token, existed);
+    return existed;
+}
+
+void ShardedTokenStore::InsertBatch(const std::vector<std::pair<int, TokenBytes>>& tokens)
+{
+    // 先按分片下标排好写入顺序，同一分片的写入连续处理；排序稳定，同一uid以后写入的为准
+    std::vector<std::pair<std::size_t, std::size_t>> order;
+    order.reserve(tokens.size());
+    for (std::size_t i = 0; i < tokens.size(); ++i) {
+        order.emplace_back(&shardFor(tokens[i].first) - _shards.get(), i);
+    }
+    std::stable_sort(order.begin(), order.end(),
+        [](const std::pair<std::size_t, std::size_t>& a, const std::pair<std::size_t, std::size_t>& b) {
+            return a.first < b.first;
+        });
+
+    std::size_t i = 0;
+    while (i < order.size()) {
+        auto& shard = _shards[order[i].first];
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        for (; i < order.size() && &_shards[order[i].first] == &shard; ++i) {
+            const auto& item = tokens[order[i].second];
+            bool existed = false;
+            insertLocked(shard, item.first, item.second, existed);
+        }
+    }
+}
+
+int ShardedTokenStore::Verify(int uid, const TokenBytes& token)
+{
+    auto& shard = shardFor(uid);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto* entry = shard.tokens.Find(uid);
+    if (!entry) {
+        ++shard.misses;
+        return ErrorCodes::UidInvalid;
+    }
+    ++shard.hits;
+    entry->referenced = true;
+    if (entry->expired || !TokenGenerator::Equal(entry->token, token)) {
+        return ErrorCodes::TokenInvalid;
+    }
+    return ErrorCodes::SUCCESS;
+}
+
+void ShardedTokenStore::Tick()
+{
+    if (_ttl_ticks == 0) {
+        return;
+    }
+
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        auto& shard = _shards[i];
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        shard.wheel.Tick([&shard, this](Expiry& expiry) {
+            auto* entry = shard.tokens.Find(expiry.uid);
+            if (!entry || entry->generation != expiry.generation) {
+                // 令牌已被刷新或删除
+                if (shard.stale_timers > 0) {
+                    --shard.stale_timers;
+                }
+                return;
+            }
+            if (!entry->expired) {
+                // 第一次到期：清掉令牌内容，只留下标记，再保留一个TTL周期后彻底删除
+                entry->expired = true;
+                entry->token = TokenBytes{};
+                shard.wheel.Add(_ttl_ticks, expiry);
+                return;
+            }
+            shard.tokens.Erase(expiry.uid);
+            });
+    }
+}
+
+std::size_t ShardedTokenStore::Size() const
+{
+    std::size_t total = 0;
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        std::lock_guard<std::mutex> guard(_shards[i].mutex);
+        total += _shards[i].tokens.Size();
+    }
+    return total;
+}
+
+std::size_t ShardedTokenStore::LiveTimers() const
+{
+    std::size_t total = 0;
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        std::lock_guard<std::mutex> guard(_shards[i].mutex);
+        // 被刷新、删除或淘汰的令牌留下的定时项还挂在轮上，等到期或压缩时才移除，不计入
+        std::size_t timers = _shards[i].wheel.Size();
+        total += timers - std::min(timers, _shards[i].stale_timers);
+    }
+    return total;
+}
+
+void ShardedTokenStore::ForEachToken(const std::function<void(int uid, const TokenBytes& token)>& visit) const
+{
+    std::vector<std::pair<int, TokenBytes>> copy;
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        copy.clear();
+        {
+            std::lock_guard<std::mutex> guard(_shards[i].mutex);
+            copy.reserve(_shards[i].tokens.Size());
+            _shards[i].tokens.ForEach([&copy](const int& uid, TokenEntry& entry) {
+                if (!entry.expired) {
+                    copy.emplace_back(uid, entry.token);
+                }
+                });
+        }
+        for (const auto& item : copy) {
+            visit(item.first, item.second);
+        }
+    }
+}
+
+TokenStoreStats ShardedTokenStore::Stats() const
+{
+    TokenStoreStats stats;
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        std::lock_guard<std::mutex> guard(_shards[i].mutex);
+        stats.hits += _shards[i].hits;
+        stats.misses += _shards[i].misses;
+        stats.evictions += _shards[i].evictions;
+        stats.bytes += _shards[i].tokens.MemoryUsage() + _shards[i].wheel.MemoryUsage();
+    }
+    return stats;
+}
+
+void ShardedTokenStore::Clear()
+{
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        std::lock_guard<std::mutex> guard(_shards[i].mutex);
+        _shards[i].tokens.Clear();
+        _shards[i].wheel = TimingWheel<Expiry>();
+        _shards[i].stale_timers = 0;
+    }
+}
+
+namespace {
+
+// 快照文件格式（本机字节序，只在同一构建的进程之间使用）：
+// SnapshotHeader，然后每个分片依次为
+// SnapshotShardHeader、控制字节、槽位数组、timer_count个SnapshotTimer
+constexpr char kSnapshotMagic[8] = { 'B', 'J', 'T', 'O', 'K', 'E', 'N', 'S' };
+constexpr uint32_t kSnapshotVersion = 1;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t shard_count;
+    uint32_t slot_size;
+    uint32_t reserved;
+    uint64_t saved_at_ms; // 写入时的系统时间（Unix毫秒）
+    uint64_t tick_ms;
+};
+
+struct SnapshotShardHeader {
+    uint64_t groups;
+    uint64_t size;
+    uint64_t growth_left;
+    uint64_t timer_count;
+    uint32_t next_generation;
+    uint32_t reserved;
+};
+
+struct SnapshotTimer {
+    uint64_t remaining; // 写入时剩余的跳数
+    int32_t uid;
+    uint32_t generation;
+};
+
+uint64_t systemNowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} // namespace
+
+bool ShardedTokenStore::SaveSnapshot(const std::string& path, uint64_t tickMs) const
+{
+    using Table = FlatHashMap<int, TokenEntry>;
+    auto tmp = path + ".tmp";
+#ifndef _WIN32
+    // 快照里是有效的令牌，先按0600创建临时文件，改名后权限不变；
+    // 临时文件已存在时open不会修改权限，再用fchmod收紧一次
+    int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return false;
+    }
+    bool restricted = ::fchmod(fd, 0600) == 0;
+    ::close(fd);
+    if (!restricted) {
+        return false;
+    }
+#endif
+    // Windows上文件继承所在目录的ACL，SnapshotPath应放在只有服务账号能访问的目录
+    std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+    header.version = kSnapshotVersion;
+    header.shard_count = static_cast<uint32_t>(ShardCount());
+    header.slot_size = static_cast<uint32_t>(Table::SlotSize());
+    header.saved_at_ms = systemNowMs();
+    header.tick_ms = tickMs;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<char> buffer;
+    std::vector<SnapshotTimer> timers;
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        const auto& shard = _shards[i];
+        SnapshotShardHeader sh{};
+        {
+            // 持锁期间只做内存复制
+            std::lock_guard<std::mutex> guard(shard.mutex);
+            auto raw = shard.tokens.Raw();
+            std::size_t ctrlBytes = raw.groups * Table::GroupWidth();
+            std::size_t slotBytes = raw.groups * Table::GroupWidth() * Table::SlotSize();
+            buffer.resize(ctrlBytes + slotBytes);
+            if (raw.groups > 0) {
+                std::memcpy(buffer.data(), raw.ctrl, ctrlBytes);
+                std::memcpy(buffer.data() + ctrlBytes, raw.slots, slotBytes);
+            }
+            // 只保留仍对应当前令牌的定时项
+            timers.clear();
+            shard.wheel.ForEach([&shard, &timers](uint64_t remaining, const Expiry& expiry) {
+                auto* entry = shard.tokens.Find(expiry.uid);
+                if (entry && entry->generation == expiry.generation) {
+                    timers.push_back(SnapshotTimer{ remaining, expiry.uid, expiry.generation });
+                }
+                });
+            sh.groups = raw.groups;
+            sh.size = raw.size;
+            sh.growth_left = raw.growth_left;
+            sh.timer_count = timers.size();
+            sh.next_generation = shard.next_generation;
+        }
+        out.write(reinterpret_cast<const char*>(&sh), sizeof(sh));
+        out.write(buffer.data(), buffer.size());
+        out.write(reinterpret_cast<const char*>(timers.data()), timers.size() * sizeof(SnapshotTimer));
+    }
+    out.close();
+    if (!out) {
+        return false;
+    }
+
+    boost::system::error_code ec;
+    boost::filesystem::rename(tmp, path, ec);
+    return !ec;
+}
+
+std::size_t ShardedTokenStore::LoadSnapshot(const std::string& path, uint64_t tickMs)
+{
+    using Table = FlatHashMap<int, TokenEntry>;
+    boost::system::error_code ec;
+    if (!boost::filesystem::exists(path, ec) || boost::filesystem::file_size(path, ec) < sizeof(SnapshotHeader)) {
+        return 0;
+    }
+
+    boost::interprocess::file_mapping mapping;
+    boost::interprocess::mapped_region region;
+    try {
+        mapping = boost::interprocess::file_mapping(path.c_str(), boost::interprocess::read_only);
+        region = boost::interprocess::mapped_region(mapping, boost::interprocess::read_only);
+    }
+    catch (const std::exception&) {
+        return 0;
+    }
+    const char* data = static_cast<const char*>(region.get_address());
+    std::size_t length = region.get_size();
+
+    SnapshotHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kSnapshotMagic, sizeof(header.magic)) != 0
+        || header.version != kSnapshotVersion
+        || header.shard_count != ShardCount()
+        || header.slot_size != Table::SlotSize()
+        || header.tick_ms == 0) {
+        return 0;
+    }
+
+    // 停机期间经过的时间换算成本进程的跳数，从剩余有效期里扣掉
+    uint64_t now = systemNowMs();
+    uint64_t elapsedTicks = 0;
+    if (now > header.saved_at_ms && tickMs > 0) {
+        elapsedTicks = (now - header.saved_at_ms) / tickMs;
+    }
+
+    // 先完整校验一遍每个分片的边界，文件被截断时一个分片都不加载
+    std::vector<std::size_t> offsets;
+    std::size_t offset = sizeof(header);
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        SnapshotShardHeader sh;
+        if (length - offset < sizeof(sh)) {
+            return 0;
+        }
+        std::memcpy(&sh, data + offset, sizeof(sh));
+        uint64_t body = sh.groups * Table::GroupWidth() * (1 + Table::SlotSize()) + sh.timer_count * sizeof(SnapshotTimer);
+        if (sh.groups > length || sh.timer_count > length || length - offset - sizeof(sh) < body) {
+            return 0;
+        }
+        offsets.push_back(offset);
+        offset += sizeof(sh) + body;
+    }
+
+    std::size_t loaded = 0;
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        auto& shard = _shards[i];
+        SnapshotShardHeader sh;
+        std::memcpy(&sh, data + offsets[i], sizeof(sh));
+        const char* ctrl = data + offsets[i] + sizeof(sh);
+        const char* slots = ctrl + sh.groups * Table::GroupWidth();
+        const char* timers = slots + sh.groups * Table::GroupWidth() * Table::SlotSize();
+
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        shard.tokens.Clear();
+        shard.wheel = TimingWheel<Expiry>();
+        shard.stale_timers = 0;
+        if (sh.groups == 0) {
+            continue;
+        }
+        Table::RawView raw{ static_cast<std::size_t>(sh.groups), static_cast<std::size_t>(sh.size),
+            static_cast<std::size_t>(sh.growth_left), ctrl, slots };
+        if (!shard.tokens.Restore(raw)) {
+            continue;
+        }
+        shard.next_generation = sh.next_generation;
+
+        if (_ttl_ticks > 0) {
+            // 快照里的剩余跳数以写入时的TickMs为单位，换算成当前配置
+            for (uint64_t t = 0; t < sh.timer_count; ++t) {
+                SnapshotTimer timer;
+                std::memcpy(&timer, timers + t * sizeof(timer), sizeof(timer));
+                uint64_t remaining = tickMs > 0 ? timer.remaining * header.tick_ms / tickMs : timer.remaining;
+                remaining = remaining > elapsedTicks ? remaining - elapsedTicks : 1;
+                shard.wheel.Add(std::min(remaining, _ttl_ticks), Expiry{ timer.uid, timer.generation });
+            }
+            if (sh.timer_count == 0) {
+                // 写快照时没有配置TTL，按完整有效期重新计时
+                shard.tokens.ForEach([&shard, this](const int& uid, TokenEntry& entry) {
+                    shard.wheel.Add(_ttl_ticks, Expiry{ uid, entry.generation });
+                    });
+            }
+        }
+        // 内存预算比写快照时更小，把超出的部分淘汰掉并缩小容量
+        if (_max_per_shard > 0 && shard.tokens.Size() > _max_per_shard) {
+            while (shard.tokens.Size() > _max_per_shard && evictOne(shard)) {
+            }
+            shard.tokens.ShrinkToFit();
+        }
+        loaded += shard.tokens.Size();
+    }
+    return loaded;
+}
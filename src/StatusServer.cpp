@@ -4,7 +4,12 @@
 #include <thread>
 #include <atomic>
 #include <chrono>
+#include <algorithm>
 #include "StatusServiceImpl.h"
+#include "AsioIOServicePool.h"
+#include "Defer.h"
+#include "AsyncLogger.h"
+#include "CoarseClock.h"
 
 // 添加全局变量用于控制服务退出
 std::atomic<bool> g_running{ true };
@@ -13,16 +18,27 @@ void RunServer() {
     std::cout << "正在初始化状态服务器..." << std::endl;
     auto& cfg = ConfigMgr::Inst();
 
+    // 日志时间和连接空闲判断使用的粗粒度时钟，ClockTickMs为刷新间隔
+    auto clock_tick = cfg["Log"]["ClockTickMs"];
+    CoarseClock::Start(std::chrono::milliseconds(clock_tick.empty() ? 10 : std::max<long long>(1, std::stoll(clock_tick))));
+    // 先创建日志实例，读取[Log]中的Level，之后第一条日志就按配置的级别过滤
+    AsyncLogger::GetInstance();
+
     std::string server_address(cfg["StatusServer"]["Host"] + ":" + cfg["StatusServer"]["Port"]);
     std::cout << "配置读取完成，服务器地址: " << server_address << std::endl;
 
     StatusServiceImpl service;
+    // 服务的定时器回调运行在IO线程池上，必须先停止并等待这些线程退出，服务才能析构，
+    // 否则析构时取消定时器会与正在执行的回调竞争。Defer在service之前析构，提前返回时同样生效
+    Defer stop_io_pool([]() { AsioIOServicePool::GetInstance()->Stop(); });
     std::cout << "服务实例已创建" << std::endl;
 
     grpc::ServerBuilder builder;
     // 监听端口和添加服务
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
     builder.RegisterService(&service);
+    // VerifyTokens双向流使用的完成队列，必须在BuildAndStart之前创建
+    auto verify_cq = builder.AddCompletionQueue();
     std::cout << "服务注册完成" << std::endl;
 
     // 构建并启动gRPC服务器
@@ -33,17 +49,29 @@ void RunServer() {
     }
     std::cout << "状态服务器启动成功，正在监听：" << server_address << std::endl;
 
+    auto verify_threads = cfg["StatusServer"]["VerifyStreamThreads"];
+    VerifyStreamServer verify_streams(&service, std::move(verify_cq),
+        [&service](int uid, const std::string& token) { return service.VerifyToken(uid, token); });
+    verify_streams.Start(verify_threads.empty() ? 2 : std::stoul(verify_threads));
+
     // 创建Boost.Asio的io_context
     boost::asio::io_context io_context;
     // 创建signal_set用于捕获SIGINT和SIGTERM
     boost::asio::signal_set signals(io_context, SIGINT, SIGTERM);
 
+    // 优雅关闭的期限：聊天服务器保持的VerifyTokens长连接不会自己结束，
+    // 超过ShutdownGraceMs仍未完成的RPC由gRPC取消，避免Shutdown无限等待
+    auto grace = cfg["StatusServer"]["ShutdownGraceMs"];
+    auto grace_ms = std::chrono::milliseconds(grace.empty() ? 5000 : std::max<long long>(0, std::stoll(grace)));
+
     // 设置异步等待信号
-    signals.async_wait([&server](const boost::system::error_code& error, int signal_number) {
+    signals.async_wait([&server, &service, grace_ms](const boost::system::error_code& error, int signal_number) {
         if (!error) {
             std::cout << "收到信号 " << signal_number << "，正在优雅关闭服务器..." << std::endl;
             g_running = false;
-            server->Shutdown(); // 优雅地关闭服务器
+            // 复制流不会自己结束，先停掉，否则Shutdown会一直等待
+            service.StopReplication();
+            server->Shutdown(std::chrono::system_clock::now() + grace_ms); // 优雅地关闭服务器
         }
         });
 
@@ -55,13 +83,18 @@ void RunServer() {
         });
 
     // 添加一个健康检查线程
-    std::thread health_thread([]() {
+    std::thread health_thread([&service]() {
         std::cout << "健康检查线程已启动" << std::endl;
         while (g_running) {
             std::this_thread::sleep_for(std::chrono::seconds(30));
             if (g_running) {
-                std::cout << "服务器运行正常，当前时间: "
-                    << std::chrono::system_clock::now().time_since_epoch().count()
+                auto stats = service.TokenStats();
+                char now[CoarseClock::kTimestampSize];
+                CoarseClock::Timestamp(now);
+                std::cout << "服务器运行正常，当前时间: " << now
+                    << "，令牌定时项: " << service.TokenTimerCount()
+                    << "，令牌命中/未命中/淘汰: " << stats.hits << "/" << stats.misses << "/" << stats.evictions
+                    << "，令牌表内存: " << stats.bytes / 1024 << " KB"
                     << std::endl;
             }
         }
@@ -73,6 +106,8 @@ void RunServer() {
     server->Wait();
 
     std::cout << "服务器已停止接收新请求" << std::endl;
+    // 服务器关闭后才能关闭完成队列
+    verify_streams.Shutdown();
     g_running = false;
     io_context.stop(); // 停止io_context
 
@@ -104,6 +139,9 @@ int main(int argc, char** argv) {
         return EXIT_FAILURE;
     }
 
+    // 写出异步日志缓冲中剩余的内容
+    AsyncLogger::GetInstance()->Stop();
+    CoarseClock::Stop();
     std::cout << "状态服务器正常退出" << std::endl;
     return 0;
 }
\ No newline at end of file
@@ -1,142 +1,414 @@
 #include "StatusServiceImpl.h"
-#include <boost/uuid/uuid.hpp>  
-#include <boost/uuid/uuid_generators.hpp>  
-#include <boost/uuid/uuid_io.hpp>
+#include "AsioIOServicePool.h"
+#include "AsyncLogger.h"
+#include "LogFormat.h"
+#include "TokenGenerator.h"
 #include <iostream>
 #include <chrono>
-#include <iomanip>
-
-// 获取当前格式化时间字符串，用于日志输出
-std::string getCurrentTimeStr() {
-    auto now = std::chrono::system_clock::now();
-    auto time_t_now = std::chrono::system_clock::to_time_t(now);
-    std::tm tm{};
-
-    // 安全转换本地时间（跨平台）
-#ifdef _WIN32
-    localtime_s(&tm, &time_t_now);  // Windows 使用 localtime_s
-#else
-    localtime_r(&time_t_now, &tm);  // Linux/macOS 使用 localtime_r
-#endif
-
-    std::stringstream ss;
-    ss << std::put_time(&tm, "[%Y-%m-%d %H:%M:%S]");
-    return ss.str();
+#include <algorithm>
+#include <sstream>
+
+// 生成16字节随机令牌，同时把文本形式写入protobuf字段，中间只经过栈上的定长缓冲
+TokenBytes set_random_token(std::string* field) {
+    TokenBytes token;
+    TokenGenerator::NextBytes(token);
+    char text[TokenGenerator::kTextLength];
+    TokenGenerator::Format(token, text);
+    field->assign(text, sizeof(text));
+    return token;
 }
 
-std::string generate_unique_string() {
-    // 创建UUID对象  
-    boost::uuids::uuid uuid = boost::uuids::random_generator()();
-
-    // 将UUID转换为字符串  
-    std::string unique_string = to_string(uuid);
-
-    std::cout << getCurrentTimeStr() << " 生成唯一令牌: " << unique_string << std::endl;
-    return unique_string;
+// 逗号分隔的配置项拆成列表，去掉每项两端的空白，跳过空项
+std::vector<std::string> split_config_list(const std::string& text) {
+    std::vector<std::string> items;
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        auto begin = item.find_first_not_of(" \t");
+        if (begin == std::string::npos) {
+            continue;
+        }
+        auto end = item.find_last_not_of(" \t");
+        items.push_back(item.substr(begin, end - begin + 1));
+    }
+    return items;
 }
 
 Status StatusServiceImpl::GetChatServer(ServerContext* context, const GetChatServerReq* request, GetChatServerRsp* reply)
 {
-    std::cout << getCurrentTimeStr() << " 收到获取聊天服务器请求，用户ID: " << request->uid() << std::endl;
+    LOGF_DEBUG("收到获取聊天服务器请求，用户ID: {}", request->uid());
 
-    const auto& server = getChatServer();
-    reply->set_host(server.host);
-    reply->set_port(server.port);
+    auto server = getChatServer(request->uid());
+    if (!server) {
+        reply->set_error(ErrorCodes::RPCGetFailed);
+        return Status::OK;
+    }
+    reply->set_host(server->host);
+    reply->set_port(server->port);
     reply->set_error(ErrorCodes::SUCCESS);
-    reply->set_token(generate_unique_string());
+    if (_signer) {
+        // 签名令牌自带校验信息，不需要写入令牌表
+        reply->set_token(_signer->Issue(request->uid(), server->name));
+    }
+    else {
+        insertToken(request->uid(), set_random_token(reply->mutable_token()));
+    }
+
+    // 直接在选中的服务器对象上递增，不需要再按名字查找；
+    // 启用预留时这次递增在Login确认前只是预留，到期未确认会自动减回
+    int count = _leases ? _leases->Grant(request->uid(), server) : _servers.AddConnections(server, 1);
+    LOGF_DEBUG("分配聊天服务器: {} (地址: {}:{})，当前连接数: {} -> {}",
+        server->name, server->host, server->port, count, count + 1);
 
-    insertToken(request->uid(), reply->token());
+    return Status::OK;
+}
 
-    std::cout << getCurrentTimeStr() << " 分配聊天服务器: " << server.name
-        << " (地址: " << server.host << ":" << server.port
-        << ")，当前连接数: " << server.con_count << std::endl;
+Status StatusServiceImpl::BatchGetChatServer(ServerContext* context, const BatchGetChatServerReq* request,
+    BatchGetChatServerRsp* reply)
+{
+    std::vector<int> uids(request->uids().begin(), request->uids().end());
+    LOGF_DEBUG("收到批量获取聊天服务器请求，用户数: {}", uids.size());
 
-    // 更新服务器连接数
-    updateServerConnectionCount(server.name, 1);
+    // 选择和计数一次完成，启用预留时再整批登记
+    auto servers = _servers.AssignBatch(uids);
+    if (_leases) {
+        _leases->GrantBatch(uids, servers);
+    }
 
+    std::vector<std::pair<int, TokenBytes>> tokens;
+    if (!_signer) {
+        tokens.reserve(uids.size());
+    }
+    std::size_t assigned = 0;
+    for (std::size_t i = 0; i < uids.size(); ++i) {
+        auto* item = reply->add_assignments();
+        item->set_uid(uids[i]);
+        if (!servers[i]) {
+            item->set_error(ErrorCodes::RPCGetFailed);
+            continue;
+        }
+        item->set_error(ErrorCodes::SUCCESS);
+        item->set_host(servers[i]->host);
+        item->set_port(servers[i]->port);
+        if (_signer) {
+            item->set_token(_signer->Issue(uids[i], servers[i]->name));
+        }
+        else {
+            tokens.emplace_back(uids[i], set_random_token(item->mutable_token()));
+        }
+        ++assigned;
+    }
+    if (_tokens) {
+        _tokens->InsertBatch(tokens);
+        if (_replication) {
+            _replication->RecordTokens(tokens);
+        }
+    }
+
+    LOGF_DEBUG("批量分配完成: {}/{}", assigned, uids.size());
+    reply->set_error(assigned == uids.size() ? ErrorCodes::SUCCESS : ErrorCodes::RPCGetFailed);
     return Status::OK;
 }
 
 StatusServiceImpl::StatusServiceImpl()
 {
-    std::cout << getCurrentTimeStr() << " 初始化状态服务实现..." << std::endl;
+    LOG_INFO << "初始化状态服务实现...";
 
     auto& cfg = ConfigMgr::Inst();
 
-    // 初始化第一个聊天服务器
-    ChatServer server;
-    server.port = cfg["ChatServer1"]["Port"];
-    server.host = cfg["ChatServer1"]["Host"];
-    server.name = cfg["ChatServer1"]["Name"];
-    server.con_count = 0;
-    _servers[server.name] = server;
-    std::cout << getCurrentTimeStr() << " 添加聊天服务器: " << server.name
-        << " (地址: " << server.host << ":" << server.port << ")" << std::endl;
+    // TokenMode = memory（默认，令牌存在本进程的分片表里）、redis（写入Redis，多实例共享）
+    // 或 signed（无状态HMAC签名令牌）
+    // TokenTTL为令牌有效期（秒），0表示永不过期；TokenTickMs为时间轮每一跳的间隔
+    auto mode = cfg["StatusServer"]["TokenMode"];
+    auto ttl = cfg["StatusServer"]["TokenTTL"];
+    uint64_t ttl_ms = ttl.empty() ? 0 : std::stoull(ttl) * 1000;
+
+    if (mode == "signed") {
+        // 签名令牌必须带过期时间，未配置TTL时默认一天
+        uint32_t ttl_seconds = ttl_ms == 0 ? 86400 : static_cast<uint32_t>(ttl_ms / 1000);
+        _signer.reset(new TokenSigner(cfg["StatusServer"]["TokenKey"], ttl_seconds));
+        LOG_INFO << "令牌模式: 签名令牌，有效期: " << ttl_seconds << " 秒";
+    }
+    else if (mode == "redis") {
+        // RedisFlushUs为写缓冲合并刷新的间隔（微秒）
+        auto flush_us = cfg["StatusServer"]["RedisFlushUs"];
+        auto interval = std::chrono::microseconds(flush_us.empty() ? 300 : std::stoll(flush_us));
+        _tokens.reset(new RedisTokenStore(static_cast<uint32_t>(ttl_ms / 1000), interval));
+        LOG_INFO << "令牌模式: Redis，刷新间隔: " << interval.count()
+            << " 微秒，有效期: " << ttl_ms / 1000 << " 秒";
+    }
+    else {
+        // 初始化令牌分片表，未配置时默认16个分片；TokenMemoryMB为令牌表的内存预算，0表示不限制
+        auto shards = cfg["StatusServer"]["TokenShards"];
+        auto budget = cfg["StatusServer"]["TokenMemoryMB"];
+        std::size_t budget_bytes = budget.empty() ? 0 : std::stoull(budget) * 1024 * 1024;
+        auto tick = cfg["StatusServer"]["TokenTickMs"];
+        _tick_ms = tick.empty() ? 1000 : std::max<uint64_t>(1, std::stoull(tick));
+        uint64_t ttl_ticks = ttl_ms == 0 ? 0 : std::max<uint64_t>(1, ttl_ms / _tick_ms);
+        auto store = new ShardedTokenStore(shards.empty() ? 16 : std::stoul(shards), ttl_ticks, budget_bytes);
+        _tokens.reset(store);
+        LOG_INFO << "令牌模式: 内存，分片数: " << store->ShardCount()
+            << "，有效期: " << ttl_ms / 1000 << " 秒，内存预算: " << budget_bytes / 1024 / 1024 << " MB";
+
+        // 令牌快照：启动时从SnapshotPath恢复，之后每SnapshotIntervalSec秒和退出时各写一次
+        // 快照里是可以直接登录的有效令牌，默认关闭，配置了路径才启用
+        _snapshot_path = cfg["StatusServer"]["SnapshotPath"];
+        if (!_snapshot_path.empty()) {
+            auto interval = cfg["StatusServer"]["SnapshotIntervalSec"];
+            _snapshot_interval = std::chrono::seconds(interval.empty() ? 60 : std::max<long long>(1, std::stoll(interval)));
+            auto start = std::chrono::steady_clock::now();
+            auto loaded = store->LoadSnapshot(_snapshot_path, _tick_ms);
+            auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+            LOG_INFO << "从快照恢复令牌 " << loaded << " 个，耗时 " << cost.count() << " 毫秒";
+            _snapshot_thread = std::thread([this]() { snapshotLoop(); });
+        }
 
-    // 初始化第二个聊天服务器
-    server.port = cfg["ChatServer2"]["Port"];
-    server.host = cfg["ChatServer2"]["Host"];
-    server.name = cfg["ChatServer2"]["Name"];
-    server.con_count = 0;
-    _servers[server.name] = server;
-    std::cout << getCurrentTimeStr() << " 添加聊天服务器: " << server.name
-        << " (地址: " << server.host << ":" << server.port << ")" << std::endl;
+        // 时间轮由IO线程池中的定时器驱动，不占用RPC线程
+        if (ttl_ticks > 0) {
+            _expire_timer.reset(new boost::asio::steady_timer(AsioIOServicePool::GetInstance()->GetIOService()));
+            _expire_timer->expires_after(std::chrono::milliseconds(_tick_ms));
+            scheduleTokenExpire();
+        }
+    }
 
-    std::cout << getCurrentTimeStr() << " 状态服务初始化完成，共注册 " << _servers.size() << " 个聊天服务器" << std::endl;
+    // BalancePolicy = least（默认，选连接数最少的）、p2c（随机两选一）、
+    // weighted（按 连接数/权重 选，权重取自各ChatServer段的Weight）
+    // 或 affinity（uid哈希到固定服务器，负载超过AffinityLoadFactor倍平均值时顺延）
+    auto policy = cfg["StatusServer"]["BalancePolicy"];
+    if (policy == "p2c") {
+        _servers.SetPolicy(BalancePolicy::TwoChoices);
+    }
+    else if (policy == "weighted") {
+        _servers.SetPolicy(BalancePolicy::WeightedLeastLoad);
+    }
+    else if (policy == "affinity") {
+        auto factor = cfg["StatusServer"]["AffinityLoadFactor"];
+        _servers.SetAffinityLoadFactor(factor.empty() ? 1.25 : std::stod(factor));
+        _servers.SetPolicy(BalancePolicy::Affinity);
+    }
+    LOG_INFO << "负载均衡策略: " << (policy.empty() ? "least" : policy);
+
+    // 故障检测器参数要在添加服务器之前设置：PhiMinStdDevMs为心跳间隔标准差的下限，
+    // AcceptableHeartbeatPauseMs为额外容忍的心跳停顿，避免心跳很规律时一次抖动就被误判下线
+    auto min_std_dev = cfg["StatusServer"]["PhiMinStdDevMs"];
+    auto pause = cfg["StatusServer"]["AcceptableHeartbeatPauseMs"];
+    _servers.SetFailureDetector(min_std_dev.empty() ? 500.0 : std::stod(min_std_dev),
+        pause.empty() ? 3000.0 : std::stod(pause));
+
+    // 初始化配置文件中的聊天服务器（ChatServer1、ChatServer2...直到某段缺失为止），
+    // 其余服务器运行期通过RegisterChatServer加入
+    for (int i = 1; ; ++i) {
+        auto section = "ChatServer" + std::to_string(i);
+        auto name = cfg[section]["Name"];
+        if (name.empty()) {
+            break;
+        }
+        auto host = cfg[section]["Host"];
+        auto port = cfg[section]["Port"];
+        auto weight = cfg[section]["Weight"];
+        int w = weight.empty() ? 1 : std::stoi(weight);
+        _servers.Add(name, host, port, w);
+        LOG_INFO << "添加聊天服务器: " << name
+            << " (地址: " << host << ":" << port << "，权重: " << w << ")";
+    }
+
+    // 故障检测：每FailureCheckMs检查一次心跳，phi超过PhiThreshold的服务器被下线
+    // 在IO线程池上执行，不占用请求路径
+    auto detect = cfg["StatusServer"]["FailureCheckMs"];
+    auto threshold = cfg["StatusServer"]["PhiThreshold"];
+    _detect_ms = detect.empty() ? 1000 : std::max<uint64_t>(1, std::stoull(detect));
+    _phi_threshold = threshold.empty() ? 8.0 : std::stod(threshold);
+    _detect_timer.reset(new boost::asio::steady_timer(AsioIOServicePool::GetInstance()->GetIOService()));
+    _detect_timer->expires_after(std::chrono::milliseconds(_detect_ms));
+    scheduleFailureCheck();
+
+    // 分配预留：LeaseMs内没有完成Login的分配会释放连接数，为0时关闭，
+    // 分配即计入连接数（旧行为）。LeaseTickMs为预留时间轮每一跳的间隔
+    auto lease = cfg["StatusServer"]["LeaseMs"];
+    uint64_t lease_ms = lease.empty() ? 10000 : std::stoull(lease);
+    if (lease_ms > 0) {
+        auto lease_tick = cfg["StatusServer"]["LeaseTickMs"];
+        _lease_tick_ms = lease_tick.empty() ? 100 : std::max<uint64_t>(1, std::stoull(lease_tick));
+        _leases.reset(new LeaseTable(_servers, std::max<uint64_t>(1, lease_ms / _lease_tick_ms)));
+        _lease_timer.reset(new boost::asio::steady_timer(AsioIOServicePool::GetInstance()->GetIOService()));
+        _lease_timer->expires_after(std::chrono::milliseconds(_lease_tick_ms));
+        scheduleLeaseExpire();
+        LOG_INFO << "分配预留期限: " << lease_ms << " 毫秒";
+    }
+
+    // 复制：全量里有全部有效令牌，默认关闭。配置了ReplicationSecret才接受备机订阅，
+    // 备机须带上相同的密钥；ReplicaAllowlist为逗号分隔的备机IP，非空时只接受这些地址。
+    // 复制流本身不加密，主备之间应走内网。ReplicaOf配置为主机地址（host:port）时本机作为备机
+    // ReplicationFlushMs为合并推送的间隔，ReplicationQueueLimit为每个备机最多积压的批次数
+    // 只有内存模式的令牌需要复制，Redis模式下令牌本来就共享，签名模式下没有令牌表
+    TokenStore* replicated_tokens = (_tokens && mode != "redis") ? _tokens.get() : nullptr;
+    auto secret = cfg["StatusServer"]["ReplicationSecret"];
+    if (!secret.empty()) {
+        auto flush = cfg["StatusServer"]["ReplicationFlushMs"];
+        auto queue_limit = cfg["StatusServer"]["ReplicationQueueLimit"];
+        auto allowed = split_config_list(cfg["StatusServer"]["ReplicaAllowlist"]);
+        _replication.reset(new ReplicationHub(_servers, replicated_tokens,
+            std::chrono::milliseconds(flush.empty() ? 20 : std::max<long long>(1, std::stoll(flush))),
+            queue_limit.empty() ? 1024 : std::stoull(queue_limit), secret, allowed));
+        LOG_INFO << "接受备机订阅，地址白名单: " << (allowed.empty() ? "不限" : cfg["StatusServer"]["ReplicaAllowlist"]);
+    }
+    auto primary = cfg["StatusServer"]["ReplicaOf"];
+    if (!primary.empty() && secret.empty()) {
+        LOG_ERROR << "配置了ReplicaOf但没有配置ReplicationSecret，主机会拒绝复制请求，不作为备机启动";
+    }
+    else if (!primary.empty()) {
+        auto name = cfg["StatusServer"]["Host"] + ":" + cfg["StatusServer"]["Port"];
+        _replica.reset(new ReplicationClient(_servers, replicated_tokens, primary, name, secret));
+        LOG_INFO << "作为备机从主机 " << primary << " 复制";
+    }
+
+    LOG_INFO << "状态服务初始化完成，共注册 " << _servers.Size() << " 个聊天服务器";
 }
 
 StatusServiceImpl::~StatusServiceImpl() {
-    std::cout << getCurrentTimeStr() << " 状态服务析构中..." << std::endl;
+    LOG_INFO << "状态服务析构中...";
+
+    // 调用者须先停止IO线程池（见RunServer），此时不会再有定时器回调在运行
+    if (_expire_timer) {
+        _expire_timer->cancel();
+    }
+    if (_detect_timer) {
+        _detect_timer->cancel();
+    }
+    if (_lease_timer) {
+        _lease_timer->cancel();
+    }
+    if (_leases) {
+        _leases->Clear();
+    }
+    if (_replica) {
+        _replica->Stop();
+    }
+    if (_replication) {
+        _replication->Stop();
+    }
+    if (_snapshot_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(_snapshot_mutex);
+            _b_stop = true;
+        }
+        _snapshot_cond.notify_all();
+        _snapshot_thread.join();
+    }
 
-    std::lock_guard<std::mutex> token_guard(_token_mutex);
-    std::lock_guard<std::mutex> server_guard(_server_mutex);
+    if (_tokens) {
+        LOG_INFO << "清理 " << _tokens->Size() << " 个令牌记录";
+        _tokens->Clear();
+    }
 
-    std::cout << getCurrentTimeStr() << " 清理 " << _tokens.size() << " 个令牌记录" << std::endl;
-    _tokens.clear();
+    LOG_INFO << "清理 " << _servers.Size() << " 个服务器记录";
+    _servers.Clear();
 
-    std::cout << getCurrentTimeStr() << " 清理 " << _servers.size() << " 个服务器记录" << std::endl;
-    _servers.clear();
+    LOG_INFO << "状态服务析构完成";
+}
 
-    std::cout << getCurrentTimeStr() << " 状态服务析构完成" << std::endl;
+std::size_t StatusServiceImpl::TokenTimerCount() const
+{
+    return _tokens ? _tokens->LiveTimers() : 0;
 }
 
-ChatServer StatusServiceImpl::getChatServer()
+TokenStoreStats StatusServiceImpl::TokenStats() const
 {
-    std::lock_guard<std::mutex> guard(_server_mutex);
+    return _tokens ? _tokens->Stats() : TokenStoreStats();
+}
 
-    // 获取负载最低的服务器
-    auto iter = _servers.begin();
-    if (iter == _servers.end()) {
-        std::cerr << getCurrentTimeStr() << " 错误：没有可用的聊天服务器！" << std::endl;
-        // 返回一个空服务器对象
-        return ChatServer();
+Status StatusServiceImpl::Replicate(ServerContext* context, const ReplicateReq* request,
+    grpc::ServerWriter<ReplicationBatch>* writer)
+{
+    if (!_replication) {
+        return Status(grpc::StatusCode::UNAVAILABLE, "replication disabled");
     }
+    return _replication->Serve(context, request, writer);
+}
 
-    auto minServer = iter->second;
-    ++iter;
+void StatusServiceImpl::StopReplication()
+{
+    if (_replica) {
+        _replica->Stop();
+    }
+    if (_replication) {
+        _replication->Stop();
+    }
+}
 
-    for (; iter != _servers.end(); ++iter) {
-        if (iter->second.con_count < minServer.con_count) {
-            minServer = iter->second;
+void StatusServiceImpl::snapshotLoop()
+{
+    std::unique_lock<std::mutex> lock(_snapshot_mutex);
+    while (true) {
+        bool stop = _snapshot_cond.wait_for(lock, _snapshot_interval, [this] { return _b_stop; });
+        lock.unlock();
+        // 退出前再写一次，部署重启时在线用户不必重新走GetChatServer
+        auto start = std::chrono::steady_clock::now();
+        bool ok = _tokens->SaveSnapshot(_snapshot_path, _tick_ms);
+        auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        if (ok) {
+            LOG_INFO << "令牌快照已写入 " << _snapshot_path << "，耗时 " << cost.count() << " 毫秒";
+        }
+        else {
+            LOG_ERROR << "错误：令牌快照写入失败: " << _snapshot_path;
+        }
+        if (stop) {
+            break;
         }
+        lock.lock();
     }
+}
 
-    return minServer;
+void StatusServiceImpl::scheduleTokenExpire()
+{
+    _expire_timer->async_wait([this](const boost::system::error_code& ec) {
+        if (ec) {
+            return; // 定时器被取消，服务正在析构
+        }
+        _tokens->Tick();
+        // 以上一次的到期时间为基准推进，避免处理耗时导致的累计漂移
+        _expire_timer->expires_at(_expire_timer->expiry() + std::chrono::milliseconds(_tick_ms));
+        scheduleTokenExpire();
+        });
 }
 
-void StatusServiceImpl::updateServerConnectionCount(const std::string& serverName, int delta) {
-    std::lock_guard<std::mutex> guard(_server_mutex);
+void StatusServiceImpl::scheduleFailureCheck()
+{
+    _detect_timer->async_wait([this](const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        for (const auto& name : _servers.CollectSuspects(_phi_threshold)) {
+            if (_servers.Remove(name)) {
+                LOG_WARN << "聊天服务器心跳超时，已下线: " << name
+                    << "，当前共 " << _servers.Size() << " 台";
+            }
+        }
+        _detect_timer->expires_at(_detect_timer->expiry() + std::chrono::milliseconds(_detect_ms));
+        scheduleFailureCheck();
+        });
+}
 
-    auto iter = _servers.find(serverName);
-    if (iter != _servers.end()) {
-        iter->second.con_count += delta;
-        std::cout << getCurrentTimeStr() << " 更新服务器 " << serverName
-            << " 连接数: " << (iter->second.con_count - delta)
-            << " -> " << iter->second.con_count << std::endl;
-    }
-    else {
-        std::cerr << getCurrentTimeStr() << " 错误：尝试更新不存在的服务器: " << serverName << std::endl;
+void StatusServiceImpl::scheduleLeaseExpire()
+{
+    _lease_timer->async_wait([this](const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        _leases->Tick();
+        _lease_timer->expires_at(_lease_timer->expiry() + std::chrono::milliseconds(_lease_tick_ms));
+        scheduleLeaseExpire();
+        });
+}
+
+std::shared_ptr<ChatServer> StatusServiceImpl::getChatServer(int uid)
+{
+    // 按配置的负载均衡策略选择服务器
+    auto server = _servers.Select(uid);
+    if (!server) {
+        LOGF_ERROR("错误：没有可用的聊天服务器！");
     }
+    return server;
 }
 
 Status StatusServiceImpl::Login(ServerContext* context, const LoginReq* request, LoginRsp* reply)
@@ -144,40 +416,146 @@ Status StatusServiceImpl::Login(ServerContext* context, const LoginReq* request,
     auto uid = request->uid();
     auto token = request->token();
 
-    std::cout << getCurrentTimeStr() << " 收到登录请求，用户ID: " << uid << std::endl;
+    LOGF_DEBUG("收到登录请求，用户ID: {}", uid);
 
-    std::lock_guard<std::mutex> guard(_token_mutex);
-    auto iter = _tokens.find(uid);
-    if (iter == _tokens.end()) {
-        std::cout << getCurrentTimeStr() << " 登录失败：无效的用户ID " << uid << std::endl;
+    auto result = VerifyToken(uid, token);
+    if (result == ErrorCodes::UidInvalid) {
+        LOGF_WARN("登录失败：无效的用户ID {}", uid);
         reply->set_error(ErrorCodes::UidInvalid);
         return Status::OK;
     }
 
-    if (iter->second != token) {
-        std::cout << getCurrentTimeStr() << " 登录失败：无效的Token，用户ID: " << uid << std::endl;
+    if (result == ErrorCodes::TokenInvalid) {
+        LOGF_WARN("登录失败：无效的Token，用户ID: {}", uid);
         reply->set_error(ErrorCodes::TokenInvalid);
         return Status::OK;
     }
 
-    std::cout << getCurrentTimeStr() << " 登录成功：用户ID " << uid << std::endl;
+    LOGF_DEBUG("登录成功：用户ID {}", uid);
     reply->set_error(ErrorCodes::SUCCESS);
     reply->set_uid(uid);
     reply->set_token(token);
     return Status::OK;
 }
 
-void StatusServiceImpl::insertToken(int uid, const std::string& token)
+int StatusServiceImpl::VerifyToken(int uid, const std::string& token)
 {
-    std::lock_guard<std::mutex> guard(_token_mutex);
+    int result = ErrorCodes::TokenInvalid;
+    TokenBytes bytes;
+    if (_signer) {
+        result = _signer->Verify(uid, token);
+    }
+    else if (TokenGenerator::Parse(token, bytes)) {
+        result = _tokens->Verify(uid, bytes);
+    }
+    // 预留转为正式连接；预留已过期时连接数已被减回，等该服务器下次心跳或上报时修正
+    if (result == ErrorCodes::SUCCESS && _leases && !_leases->Confirm(uid)) {
+        LOGF_WARN("用户 {} 的分配预留已过期，连接数待心跳修正", uid);
+    }
+    return result;
+}
 
-    auto iter = _tokens.find(uid);
-    if (iter != _tokens.end()) {
-        std::cout << getCurrentTimeStr() << " 更新用户 " << uid << " 的令牌" << std::endl;
+Status StatusServiceImpl::ReportLoad(ServerContext* context, const ReportLoadReq* request, ReportLoadRsp* reply)
+{
+    // 上报的是绝对连接数，直接覆盖，之前分配后未连上或已断开的偏差一并修正
+    for (const auto& load : request->loads()) {
+        auto server = _servers.Find(load.name());
+        if (!server) {
+            LOGF_ERROR("错误：收到不存在的服务器负载上报: {}", load.name());
+            continue;
+        }
+        int before = _servers.SetConnections(server, load.con_count());
+        LOGF_DEBUG("服务器 {} 上报连接数: {} -> {}", load.name(), before, load.con_count());
     }
-    else {
-        std::cout << getCurrentTimeStr() << " 为用户 " << uid << " 创建新令牌" << std::endl;
+
+    reply->set_error(ErrorCodes::SUCCESS);
+    return Status::OK;
+}
+
+Status StatusServiceImpl::RegisterChatServer(ServerContext* context, const RegisterChatServerReq* request,
+    RegisterChatServerRsp* reply)
+{
+    if (request->name().empty() || request->host().empty() || request->port().empty()) {
+        reply->set_error(ErrorCodes::ServerInfoInvalid);
+        return Status::OK;
+    }
+
+    // 同名同地址视为重复注册，直接成功；地址变化说明进程换了位置，先下线旧记录
+    auto existing = _servers.Find(request->name());
+    if (existing && existing->host == request->host() && existing->port == request->port()) {
+        reply->set_error(ErrorCodes::SUCCESS);
+        return Status::OK;
+    }
+    if (existing) {
+        _servers.Remove(request->name());
     }
 
-    _tokens[uid] = token;
+    int weight = request->weight() > 0 ? request->weight() : 1;
+    if (!_servers.Add(request->name(), request->host(), request->port(), weight)) {
+        // 查找和添加之间另一个同名注册抢先完成，由调用方重试
+        LOG_WARN << "聊天服务器注册冲突: " << request->name() << " 已被并发的注册请求加入";
+        reply->set_error(ErrorCodes::ServerAlreadyRegistered);
+        return Status::OK;
+    }
+    LOG_INFO << "聊天服务器上线: " << request->name()
+        << " (地址: " << request->host() << ":" << request->port() << "，权重: " << weight
+        << ")，当前共 " << _servers.Size() << " 台";
+
+    reply->set_error(ErrorCodes::SUCCESS);
+    return Status::OK;
+}
+
+Status StatusServiceImpl::Heartbeat(ServerContext* context, const HeartbeatReq* request, HeartbeatRsp* reply)
+{
+    // 心跳频率高，成功时不打印日志
+    if (!_servers.Heartbeat(request->name(), request->con_count())) {
+        reply->set_error(ErrorCodes::ServerNotRegistered);
+        return Status::OK;
+    }
+    reply->set_error(ErrorCodes::SUCCESS);
+    return Status::OK;
+}
+
+Status StatusServiceImpl::Deregister(ServerContext* context, const DeregisterReq* request, DeregisterRsp* reply)
+{
+    if (!_servers.Remove(request->name())) {
+        reply->set_error(ErrorCodes::ServerNotRegistered);
+        return Status::OK;
+    }
+    LOG_INFO << "聊天服务器下线: " << request->name()
+        << "，当前共 " << _servers.Size() << " 台";
+    reply->set_error(ErrorCodes::SUCCESS);
+    return Status::OK;
+}
+
+Status StatusServiceImpl::SetLogLevel(ServerContext* context, const SetLogLevelReq* request, SetLogLevelRsp* reply)
+{
+    if (!request->level().empty()) {
+        LogLevel level;
+        if (!AsyncLogger::ParseLevel(request->level(), level)) {
+            reply->set_error(ErrorCodes::LogLevelInvalid);
+            reply->set_level(AsyncLogger::LevelName(AsyncLogger::Level()));
+            return Status::OK;
+        }
+        // 先记录再切换，切到warn、error或off时这条日志也能留下
+        LOG_WARN << "日志级别由 " << AsyncLogger::LevelName(AsyncLogger::Level())
+            << " 切换为 " << AsyncLogger::LevelName(level);
+        AsyncLogger::SetLevel(level);
+    }
+    reply->set_error(ErrorCodes::SUCCESS);
+    reply->set_level(AsyncLogger::LevelName(AsyncLogger::Level()));
+    return Status::OK;
+}
+
+void StatusServiceImpl::insertToken(int uid, const TokenBytes& token)
+{
+    if (_replication) {
+        _replication->RecordToken(uid, token);
+    }
+    if (_tokens->Insert(uid, token)) {
+        LOGF_DEBUG("更新用户 {} 的令牌", uid);
+    }
+    else {
+        LOGF_DEBUG("为用户 {} 创建新令牌", uid);
+    }
 }
\ No newline at end of file
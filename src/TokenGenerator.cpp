@@ -0,0 +1,118 @@
+#include "TokenGenerator.h"
+#include <cstring>
+#include <stdexcept>
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+
+namespace {
+
+// 线程私有的随机字节缓冲，用完后整块从RAND_bytes重新取
+class RandomBuffer
+{
+public:
+    RandomBuffer() : _pos(sizeof(_buffer)) {}
+
+    ~RandomBuffer() {
+        OPENSSL_cleanse(_buffer, sizeof(_buffer));
+    }
+
+    void Fill(uint8_t* out, std::size_t len) {
+        while (len > 0) {
+            if (_pos == sizeof(_buffer)) {
+                refill();
+            }
+            std::size_t n = sizeof(_buffer) - _pos;
+            if (n > len) {
+                n = len;
+            }
+            std::memcpy(out, _buffer + _pos, n);
+            // 已输出的字节立即清掉，内存泄露时也拿不到历史令牌
+            std::memset(_buffer + _pos, 0, n);
+            _pos += n;
+            out += n;
+            len -= n;
+        }
+    }
+
+private:
+    void refill() {
+        if (RAND_bytes(_buffer, static_cast<int>(sizeof(_buffer))) != 1) {
+            throw std::runtime_error("令牌生成器获取随机数失败");
+        }
+        _pos = 0;
+    }
+
+    uint8_t _buffer[TokenGenerator::kBufferBytes];
+    std::size_t _pos;
+};
+
+thread_local RandomBuffer t_random;
+
+const char kHex[] = "0123456789abcdef";
+
+int hexValue(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+bool isDashPosition(std::size_t pos)
+{
+    return pos == 8 || pos == 13 || pos == 18 || pos == 23;
+}
+
+} // namespace
+
+void TokenGenerator::NextBytes(TokenBytes& out)
+{
+    t_random.Fill(out.data, kTokenBytes);
+    out.data[6] = static_cast<uint8_t>((out.data[6] & 0x0F) | 0x40); // 版本4
+    out.data[8] = static_cast<uint8_t>((out.data[8] & 0x3F) | 0x80); // RFC 4122 变体
+}
+
+void TokenGenerator::Format(const TokenBytes& bytes, char (&out)[kTextLength])
+{
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < kTokenBytes; ++i) {
+        if (isDashPosition(pos)) {
+            out[pos++] = '-';
+        }
+        out[pos++] = kHex[bytes.data[i] >> 4];
+        out[pos++] = kHex[bytes.data[i] & 0x0F];
+    }
+}
+
+std::string TokenGenerator::ToString(const TokenBytes& bytes)
+{
+    char text[kTextLength];
+    Format(bytes, text);
+    return std::string(text, sizeof(text));
+}
+
+bool TokenGenerator::Parse(const std::string& text, TokenBytes& out)
+{
+    if (text.size() != kTextLength) {
+        return false;
+    }
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i < kTokenBytes; ++i) {
+        if (isDashPosition(pos)) {
+            if (text[pos++] != '-') {
+                return false;
+            }
+        }
+        int hi = hexValue(text[pos++]);
+        int lo = hexValue(text[pos++]);
+        if (hi < 0 || lo < 0) {
+            return false;
+        }
+        out.data[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return true;
+}
+
+bool TokenGenerator::Equal(const TokenBytes& a, const TokenBytes& b)
+{
+    return CRYPTO_memcmp(a.data, b.data, kTokenBytes) == 0;
+}
@@ -0,0 +1,150 @@
+#include "TokenSigner.h"
+#include "const.h"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+namespace {
+
+constexpr uint8_t kTokenVersion = 1;
+constexpr std::size_t kHeaderLen = 1 + 4 + 4 + 1; // 版本 + uid + 过期时间 + 服务器名长度
+constexpr std::size_t kMacLen = 16;               // HMAC-SHA256 截断到128位
+
+const char kBase64Url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+std::string base64UrlEncode(const unsigned char* data, std::size_t len)
+{
+    std::string out;
+    out.reserve((len * 4 + 2) / 3);
+    std::size_t i = 0;
+    for (; i + 3 <= len; i += 3) {
+        uint32_t v = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+        out.push_back(kBase64Url[(v >> 18) & 0x3F]);
+        out.push_back(kBase64Url[(v >> 12) & 0x3F]);
+        out.push_back(kBase64Url[(v >> 6) & 0x3F]);
+        out.push_back(kBase64Url[v & 0x3F]);
+    }
+    if (len - i == 1) {
+        uint32_t v = data[i] << 16;
+        out.push_back(kBase64Url[(v >> 18) & 0x3F]);
+        out.push_back(kBase64Url[(v >> 12) & 0x3F]);
+    }
+    else if (len - i == 2) {
+        uint32_t v = (data[i] << 16) | (data[i + 1] << 8);
+        out.push_back(kBase64Url[(v >> 18) & 0x3F]);
+        out.push_back(kBase64Url[(v >> 12) & 0x3F]);
+        out.push_back(kBase64Url[(v >> 6) & 0x3F]);
+    }
+    return out;
+}
+
+int base64UrlValue(char c)
+{
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+    if (c >= '0' && c <= '9') return c - '0' + 52;
+    if (c == '-') return 62;
+    if (c == '_') return 63;
+    return -1;
+}
+
+bool base64UrlDecode(const std::string& in, std::string& out)
+{
+    if (in.size() % 4 == 1) {
+        return false;
+    }
+    out.clear();
+    out.reserve(in.size() * 3 / 4);
+    uint32_t acc = 0;
+    int bits = 0;
+    for (char c : in) {
+        int v = base64UrlValue(c);
+        if (v < 0) {
+            return false;
+        }
+        acc = (acc << 6) | static_cast<uint32_t>(v);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out.push_back(static_cast<char>((acc >> bits) & 0xFF));
+        }
+    }
+    return true;
+}
+
+void putU32(unsigned char* p, uint32_t v)
+{
+    p[0] = static_cast<unsigned char>(v >> 24);
+    p[1] = static_cast<unsigned char>(v >> 16);
+    p[2] = static_cast<unsigned char>(v >> 8);
+    p[3] = static_cast<unsigned char>(v);
+}
+
+uint32_t getU32(const unsigned char* p)
+{
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+uint32_t nowSeconds()
+{
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+}
+
+} // namespace
+
+TokenSigner::TokenSigner(const std::string& key, uint32_t ttlSeconds)
+    : _key(key), _ttl_seconds(ttlSeconds)
+{
+    if (_key.empty()) {
+        throw std::runtime_error("签名令牌模式需要配置 TokenKey");
+    }
+}
+
+std::string TokenSigner::Issue(int uid, const std::string& serverName) const
+{
+    // 服务器名长度只占一个字节，超出部分截掉（签名覆盖截断后的内容，不影响校验）
+    std::size_t nameLen = serverName.size() > 255 ? 255 : serverName.size();
+    unsigned char buf[kHeaderLen + 255 + EVP_MAX_MD_SIZE];
+    buf[0] = kTokenVersion;
+    putU32(buf + 1, static_cast<uint32_t>(uid));
+    putU32(buf + 5, nowSeconds() + _ttl_seconds);
+    buf[9] = static_cast<unsigned char>(nameLen);
+    std::copy(serverName.data(), serverName.data() + nameLen, buf + kHeaderLen);
+
+    std::size_t payloadLen = kHeaderLen + nameLen;
+    unsigned int macLen = 0;
+    HMAC(EVP_sha256(), _key.data(), static_cast<int>(_key.size()), buf, payloadLen, buf + payloadLen, &macLen);
+
+    return base64UrlEncode(buf, payloadLen + kMacLen);
+}
+
+int TokenSigner::Verify(int uid, const std::string& token) const
+{
+    std::string raw;
+    if (!base64UrlDecode(token, raw) || raw.size() < kHeaderLen + kMacLen) {
+        return ErrorCodes::TokenInvalid;
+    }
+
+    auto data = reinterpret_cast<const unsigned char*>(raw.data());
+    std::size_t payloadLen = kHeaderLen + data[9];
+    if (data[0] != kTokenVersion || raw.size() != payloadLen + kMacLen) {
+        return ErrorCodes::TokenInvalid;
+    }
+
+    unsigned char mac[EVP_MAX_MD_SIZE];
+    unsigned int macLen = 0;
+    HMAC(EVP_sha256(), _key.data(), static_cast<int>(_key.size()), data, payloadLen, mac, &macLen);
+    // 常量时间比较，避免按字节提前返回泄露签名信息
+    if (CRYPTO_memcmp(mac, data + payloadLen, kMacLen) != 0) {
+        return ErrorCodes::TokenInvalid;
+    }
+
+    if (getU32(data + 1) != static_cast<uint32_t>(uid) || getU32(data + 5) <= nowSeconds()) {
+        return ErrorCodes::TokenInvalid;
+    }
+    return ErrorCodes::SUCCESS;
+}
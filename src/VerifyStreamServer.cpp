@@ -0,0 +1,190 @@
+#include "VerifyStreamServer.h"
+#include <deque>
+#include <mutex>
+#include "LogFormat.h"
+
+namespace {
+// 单条流上积压的未发送响应超过这个数量时暂停读取，等写出去一部分再继续
+constexpr std::size_t kMaxQueuedResponses = 1024;
+}
+
+// 一条VerifyTokens流的状态机
+// 每种异步操作有自己的标签，完成队列返回标签后由Proceed分发；
+// 读、写各自最多只有一个在途操作，所有在途操作都结束并且Finish完成后才释放自己。
+class VerifyStreamServer::Call
+{
+public:
+    enum class Op { Connect, Read, Write, Finish };
+
+    struct Tag {
+        Call* call;
+        Op op;
+    };
+
+    Call(VerifyStreamServer* owner)
+        : _owner(owner), _stream(&_ctx),
+        _connect_tag{ this, Op::Connect }, _read_tag{ this, Op::Read },
+        _write_tag{ this, Op::Write }, _finish_tag{ this, Op::Finish },
+        _reading(false), _writing(false), _read_paused(false), _finishing(false)
+    {
+        _owner->_service->RequestVerifyTokens(&_ctx, &_stream, _owner->_cq.get(), _owner->_cq.get(), &_connect_tag);
+    }
+
+    void Proceed(Op op, bool ok) {
+        bool destroy = false;
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            switch (op) {
+            case Op::Connect:
+                destroy = onConnect(ok);
+                break;
+            case Op::Read:
+                onRead(ok);
+                break;
+            case Op::Write:
+                onWrite(ok);
+                break;
+            case Op::Finish:
+                destroy = true;
+                break;
+            }
+        }
+        if (destroy) {
+            delete this;
+        }
+    }
+
+private:
+    bool onConnect(bool ok) {
+        if (!ok) {
+            return true; // 服务器正在关闭，等待中的请求被取消
+        }
+        // 先挂上下一个等待新连接的对象，再处理本条流
+        new Call(_owner);
+        startRead();
+        return false;
+    }
+
+    void onRead(bool ok) {
+        _reading = false;
+        if (!ok) {
+            // 对端关闭了写方向或流已断开，发完积压的响应后结束
+            maybeFinish();
+            return;
+        }
+
+        message::VerifyTokenRsp rsp;
+        rsp.set_request_id(_request.request_id());
+        rsp.set_uid(_request.uid());
+        rsp.set_error(_owner->_verifier(_request.uid(), _request.token()));
+        _responses.push_back(std::move(rsp));
+        startWrite();
+
+        if (_responses.size() >= kMaxQueuedResponses) {
+            _read_paused = true;
+            return;
+        }
+        startRead();
+    }
+
+    void onWrite(bool ok) {
+        _writing = false;
+        if (!ok) {
+            // 流已断开，剩下的响应无法送达
+            _responses.clear();
+            _read_paused = false;
+            maybeFinish();
+            return;
+        }
+        _responses.pop_front();
+        if (_read_paused && _responses.size() < kMaxQueuedResponses / 2) {
+            _read_paused = false;
+            startRead();
+        }
+        startWrite();
+        maybeFinish();
+    }
+
+    void startRead() {
+        _reading = true;
+        _stream.Read(&_request, &_read_tag);
+    }
+
+    void startWrite() {
+        if (_writing || _responses.empty()) {
+            return;
+        }
+        _writing = true;
+        _stream.Write(_responses.front(), &_write_tag);
+    }
+
+    // 读方向已结束、没有在途写并且没有积压时才能Finish
+    void maybeFinish() {
+        if (_finishing || _reading || _read_paused || _writing || !_responses.empty()) {
+            return;
+        }
+        _finishing = true;
+        _stream.Finish(grpc::Status::OK, &_finish_tag);
+    }
+
+    VerifyStreamServer* _owner;
+    grpc::ServerContext _ctx;
+    grpc::ServerAsyncReaderWriter<message::VerifyTokenRsp, message::VerifyTokenReq> _stream;
+    Tag _connect_tag;
+    Tag _read_tag;
+    Tag _write_tag;
+    Tag _finish_tag;
+
+    std::mutex _mutex; // 多个轮询线程可能同时拿到同一条流的读完成和写完成
+    message::VerifyTokenReq _request;
+    std::deque<message::VerifyTokenRsp> _responses; // 队首是正在写的响应
+    bool _reading;
+    bool _writing;
+    bool _read_paused;
+    bool _finishing;
+};
+
+VerifyStreamServer::VerifyStreamServer(AsyncService* service, std::unique_ptr<grpc::ServerCompletionQueue> cq,
+    Verifier verifier)
+    : _service(service), _cq(std::move(cq)), _verifier(std::move(verifier)), _b_stop(false)
+{
+}
+
+VerifyStreamServer::~VerifyStreamServer()
+{
+    Shutdown();
+}
+
+void VerifyStreamServer::Start(std::size_t threads)
+{
+    new Call(this);
+    for (std::size_t i = 0; i < (threads == 0 ? 1 : threads); ++i) {
+        _threads.emplace_back([this]() { run(); });
+    }
+    LOGF_INFO("令牌校验流已启动，轮询线程数: {}", _threads.size());
+}
+
+void VerifyStreamServer::Shutdown()
+{
+    if (_b_stop) {
+        return;
+    }
+    _b_stop = true;
+    // 关闭后队列里剩余的事件都会以ok=false返回，由轮询线程处理完毕后退出
+    _cq->Shutdown();
+    for (auto& t : _threads) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+}
+
+void VerifyStreamServer::run()
+{
+    void* tag = nullptr;
+    bool ok = false;
+    while (_cq->Next(&tag, &ok)) {
+        auto* t = static_cast<Call::Tag*>(tag);
+        t->call->Proceed(t->op, ok);
+    }
+}
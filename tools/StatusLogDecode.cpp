@@ -0,0 +1,159 @@
+// statuslog-decode：把[Log] Format = binary写出的二进制日志还原为文本
+// 用法：statuslog-decode status.blog [更多文件...]
+// 输出格式与文本日志相同："[YYYY-mm-dd HH:MM:SS] [LEVEL] 内容"
+// 必须在与状态服务字节序相同的机器上解码
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include "CoarseClock.h"
+#include "LogFormat.h"
+
+namespace {
+
+const char kMagic[8] = { 'B', 'J', 'S', 'T', 'L', 'O', 'G', '1' };
+const char* const kLevelTags[] = { "[DEBUG] ", "[INFO] ", "[WARN] ", "[ERROR] " };
+
+class Reader
+{
+public:
+    explicit Reader(const std::string& data) : _cursor(data.data()), _end(data.data() + data.size()) {}
+
+    bool Done() const { return _cursor >= _end; }
+    std::size_t Offset(const std::string& data) const { return _cursor - data.data(); }
+
+    template <typename T>
+    bool Read(T& value) {
+        if (static_cast<std::size_t>(_end - _cursor) < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, _cursor, sizeof(T));
+        _cursor += sizeof(T);
+        return true;
+    }
+    bool Read(std::size_t size, std::string& out) {
+        if (static_cast<std::size_t>(_end - _cursor) < size) {
+            return false;
+        }
+        out.assign(_cursor, size);
+        _cursor += size;
+        return true;
+    }
+    bool ReadBytes(std::string& out) {
+        uint16_t length;
+        return Read(length) && Read(length, out);
+    }
+    bool Magic() {
+        if (static_cast<std::size_t>(_end - _cursor) < sizeof(kMagic)
+            || std::memcmp(_cursor, kMagic, sizeof(kMagic)) != 0) {
+            return false;
+        }
+        _cursor += sizeof(kMagic);
+        return true;
+    }
+
+private:
+    const char* _cursor;
+    const char* _end;
+};
+
+// 解码一个文件，返回是否完整解码
+bool decode(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::fprintf(stderr, "无法打开文件: %s\n", path.c_str());
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    Reader reader(data);
+    // 格式编号只在一次运行内有效，每遇到一个文件头就重新开始
+    std::unordered_map<uint32_t, std::string> formats;
+    std::string line;
+    std::string text;
+    int64_t last_second = -1;
+    char timestamp[CoarseClock::kTimestampSize] = {};
+    while (!reader.Done()) {
+        if (reader.Magic()) {
+            formats.clear();
+            continue;
+        }
+        char type;
+        reader.Read(type);
+        if (type == 'F') {
+            uint32_t id;
+            uint8_t level;
+            uint32_t source_line;
+            std::string file;
+            std::string format;
+            if (!reader.Read(id) || !reader.Read(level) || !reader.Read(source_line)
+                || !reader.ReadBytes(file) || !reader.ReadBytes(format)) {
+                break;
+            }
+            formats[id] = format;
+        }
+        else if (type == 'R') {
+            uint32_t id;
+            int64_t time_ms;
+            uint8_t level;
+            uint8_t truncated;
+            uint16_t length;
+            if (!reader.Read(id) || !reader.Read(time_ms) || !reader.Read(level)
+                || !reader.Read(truncated) || !reader.Read(length) || !reader.Read(length, text)) {
+                break;
+            }
+            int64_t second = time_ms / 1000;
+            if (second != last_second) {
+                CoarseClock::Format(second, timestamp);
+                last_second = second;
+            }
+            line.assign(timestamp);
+            line.push_back(' ');
+            line.append(level < sizeof(kLevelTags) / sizeof(kLevelTags[0]) ? kLevelTags[level] : "[?] ");
+            if (id == 0) {
+                line.append(text);
+            }
+            else {
+                auto iter = formats.find(id);
+                if (iter != formats.end()) {
+                    RenderLogFormat(iter->second, text.data(), text.size(), line);
+                }
+                else {
+                    line.append("未知的日志格式 ");
+                    line.append(std::to_string(id));
+                }
+            }
+            line.append(truncated ? "...\n" : "\n");
+            std::fwrite(line.data(), 1, line.size(), stdout);
+        }
+        else {
+            std::fprintf(stderr, "%s: 偏移 %zu 处数据无法识别\n", path.c_str(), reader.Offset(data) - 1);
+            return false;
+        }
+    }
+    if (!reader.Done()) {
+        // 进程异常退出时最后一批可能只写了一半
+        std::fprintf(stderr, "%s: 文件末尾的记录不完整\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "用法: %s <二进制日志文件>...\n", argv[0]);
+        return 2;
+    }
+    bool ok = true;
+    for (int i = 1; i < argc; ++i) {
+        ok = decode(argv[i]) && ok;
+    }
+    std::fflush(stdout);
+    return ok ? 0 : 1;
+}